@@ -36,6 +36,7 @@
 #define calculatorfunction_h
 
 #include "function.h"
+#include "parser.h"
 
 ///@name Input fields for CalculatorFunction
 //@{
@@ -49,7 +50,8 @@
 namespace oofem {
 /**
  * Class representing user defined load time function. User input is function expression.
- * Uses Parser class to parse given expression. Slow but useful.
+ * Uses Parser class to compile the given expressions once, when the function is initialized.
+ * Time derivatives that are not given explicitly are obtained by symbolic differentiation of the function expression.
  * Load time function typically belongs to domain and is
  * attribute of one or more loads. Generally load time function is real function of time (@f$ y=f(t) @f$).
  */
@@ -62,6 +64,8 @@ private:
     std :: string dfdtExpression;
     /// Expression for second time derivative.
     std :: string d2fdt2Expression;
+    /// Compiled function value and time derivatives.
+    CompiledExpression f, dfdt, d2fdt2;
 
 public:
     /**
@@ -82,13 +86,20 @@ public:
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &ir);
 
-    virtual void evaluate(FloatArray &answer, const std :: map< std :: string, FunctionArgument > &valDict);
+    virtual void evaluate(FloatArray &answer, const std :: map< std :: string, FunctionArgument > &valDict, GaussPoint *gp=NULL, double param=0.);
+    virtual void evaluateAtPoints(FloatArray &answer, const std :: vector< FloatArray > &coords, const FloatArray &times);
     virtual double evaluateAtTime(double t);
     virtual double evaluateVelocityAtTime(double t);
     virtual double evaluateAccelerationAtTime(double t);
 
     virtual const char *giveClassName() const { return "CalculatorFunction"; }
     virtual const char *giveInputRecordName() const { return _IFT_CalculatorFunction_Name; }
+
+protected:
+    /// Compiles the expressions and derives the missing time derivatives.
+    void compileExpressions();
+    /// Evaluates compiled expression at given time, which must be its only free variable.
+    double evaluateCompiledAtTime(const CompiledExpression &e, double time);
 };
 } // end namespace oofem
 #endif // calculatorfunction_h
@@ -49,6 +49,7 @@
 #include "dofiditem.h"
 
 #include <map>
+#include <set>
 #include <string>
 #include <cstring>
 #include <memory>
@@ -155,6 +156,8 @@ template< typename T > ContactDefinition *contactDefCreator(ContactManager *cMan
 //@{
 #define REGISTER_Element(class) static bool __dummy_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerElement(_IFT_ ## class ## _Name, elemCreator< class > );
 #define REGISTER_DofManager(class) static bool __dummy_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerDofManager(_IFT_ ## class ## _Name, dofmanCreator< class > );
+#define REGISTER_BulkElement(class) static bool __dummy_bulk_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerBulkElement(_IFT_ ## class ## _Name);
+#define REGISTER_BulkDofManager(class) static bool __dummy_bulk_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerBulkDofManager(_IFT_ ## class ## _Name);
 #define REGISTER_BoundaryCondition(class) static bool __dummy_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerBoundaryCondition(_IFT_ ## class ## _Name, bcCreator< class > );
 #define REGISTER_CrossSection(class) static bool __dummy_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerCrossSection(_IFT_ ## class ## _Name, csCreator< class > );
 #define REGISTER_Material(class) static bool __dummy_ ## class OOFEM_ATTR_UNUSED = GiveClassFactory().registerMaterial(_IFT_ ## class ## _Name, matCreator< class > );
@@ -210,6 +213,10 @@ private:
     std :: map < std :: string, Element * ( * )(int, Domain *) > elemList;
     /// Associative container containing dofmanager creators with dofmanager  name as key.
     std :: map < std :: string, DofManager * ( * )(int, Domain *) > dofmanList;
+    /// Names of elements which support bulk (concurrent) initialization.
+    std :: set< std :: string > bulkElemList;
+    /// Names of dof managers which support bulk (concurrent) initialization.
+    std :: set< std :: string > bulkDofmanList;
     /// Associative container containing boundary condition creators with bc  name as key.
     std :: map < std :: string, GeneralBoundaryCondition * ( * )(int, Domain *) > bcList;
     /// Associative container containing cross section creators with cross section name as key.
@@ -309,6 +316,24 @@ public:
      * @param name Keyword string.
      */
     bool registerDofManager( const char *name, DofManager * ( *creator )( int, Domain * ) );
+    /**
+     * Marks the element as supporting bulk initialization.
+     * Such elements only modify the receiver in initializeFrom, so that several instances
+     * can be initialized concurrently when the domain is instanciated.
+     * Derived classes are not covered and have to be registered separately.
+     * @param name Keyword string.
+     */
+    bool registerBulkElement(const char *name);
+    /**
+     * Marks the dof manager as supporting bulk initialization.
+     * @see registerBulkElement
+     * @param name Keyword string.
+     */
+    bool registerBulkDofManager(const char *name);
+    /// Returns true if element with given keyword supports bulk initialization.
+    bool isBulkElement(const char *name) const;
+    /// Returns true if dof manager with given keyword supports bulk initialization.
+    bool isBulkDofManager(const char *name) const;
     /**
      * Creates new instance of boundary condition corresponding to given keyword.
      * @param name Keyword string determining the type of new instance.
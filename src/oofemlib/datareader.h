@@ -83,6 +83,12 @@ public:
      */
     virtual bool peakNext(const std :: string &keyword) { return false; }
 
+    /**
+     * Returns true if records returned by giveInputRecord remain valid until finish() is called,
+     * which allows several records to be processed at once (e.g. concurrently).
+     */
+    virtual bool hasPersistentRecords() const { return false; }
+
     /**
      * Allows to detach all data connections.
      */
@@ -86,6 +86,7 @@ public:
 
     virtual InputRecord *giveInputRecord(InputRecordType, int recordId);
     virtual bool peakNext(const std :: string &keyword);
+    virtual bool hasPersistentRecords() const { return true; }
     virtual void finish();
     virtual std :: string giveReferenceName() const { return name; }
 
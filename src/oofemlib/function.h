@@ -42,6 +42,7 @@
 #include "gausspoint.h"
 
 #include <map>
+#include <vector>
 #include <algorithm>
 
 ///@name Input fields for Function
@@ -121,6 +122,14 @@ public:
      * @return Function value.
      */
     virtual double evaluate(const std :: map< std :: string, FunctionArgument > &valDict);
+    /**
+     * Evaluates the (scalar) function at a batch of points, e.g. all integration points of a spatially varying load.
+     * The default implementation calls evaluate for each point.
+     * @param answer Function values, one per point.
+     * @param coords Coordinates of the points, passed as argument "x".
+     * @param times Time at each point, passed as argument "t". A single value is used for all points.
+     */
+    virtual void evaluateAtPoints(FloatArray &answer, const std :: vector< FloatArray > &coords, const FloatArray &times);
 
     /**
      * Returns the value of the function at given time.
@@ -85,6 +85,8 @@ private:
 
     /// Tolerance of residual.
     double tol;
+    /// Tolerance overriding the input one (non-positive if not used).
+    double tolOverride;
     /// Max number of iterations.
     int maxite;
 
@@ -95,6 +97,7 @@ public:
     virtual ~IMLSolver() {}
 
     NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x) override;
+    void setRelativeTolerance(double rtol) override { tolOverride = rtol; }
 
     IRResultType initializeFrom(InputRecord *ir) override;
     const char *giveClassName() const override { return "IMLSolver"; }
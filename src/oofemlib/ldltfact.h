@@ -69,6 +69,15 @@ public:
      * @return NM_Status value
      */
     virtual NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
+    /**
+     * Solves the given linear system with several right hand sides.
+     * The matrix is factorized once and the back substitution is done for all right hand sides at once.
+     * @param A coefficient matrix
+     * @param B right hand sides
+     * @param X solution matrix
+     * @return NM_Status value
+     */
+    virtual NM_Status solve(SparseMtrx &A, FloatMatrix &B, FloatMatrix &X);
 
     virtual const char *giveClassName() const { return "LDLTFactorization"; }
     virtual LinSystSolverType giveLinSystSolverType() const { return ST_Direct; }
@@ -36,10 +36,12 @@
 #define mklpardisosolver_h
 
 #include "sparselinsystemnm.h"
+#include "intarray.h"
 
 #define _IFT_MKLPardisoSolver_Name "mklpardiso"
 
 namespace oofem {
+class FloatMatrix;
 
 /**
  * Implements the solution of linear system of equation in the form @f$ A\cdot x=b @f$ using solvers
@@ -50,6 +52,26 @@ namespace oofem {
  */
 class OOFEM_EXPORT MKLPardisoSolver : public SparseLinearSystemNM
 {
+protected:
+    /// Internal solver memory pointer, kept between solves to reuse the factorization.
+    void *pt [ 64 ];
+    /// Pardiso control parameters.
+    IntArray iparm;
+    /// Matrix type of the kept factorization.
+    int mtype;
+    /// Flag indicating that pt holds the factorization data.
+    bool initialized;
+    /// Sparsity pattern of the kept factorization (column pointers and row indices).
+    IntArray factorizedColPtr, factorizedRowIndex;
+
+    /// Releases the internal memory of Pardiso.
+    void releaseFactorization();
+    /**
+     * Solves the linear system for nrhs right hand sides stored in column major order.
+     * The factorization is computed only if the matrix has been changed.
+     */
+    NM_Status solve(SparseMtrx &A, int nrhs, const double *b, double *x);
+
 public:
     /**
      * Constructor.
@@ -60,7 +82,17 @@ public:
 
     virtual ~MKLPardisoSolver();
 
+    /**
+     * Solves the given linear system.
+     * The factorization is kept, so that only back substitution is performed if the matrix has not changed.
+     * If only the values have changed (same sparsity pattern), the reordering and symbolic factorization are reused.
+     */
     virtual NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
+    /**
+     * Solves the given linear system with several right hand sides in one back substitution.
+     */
+    virtual NM_Status solve(SparseMtrx &A, FloatMatrix &B, FloatMatrix &X);
+    virtual void invalidateFactorization();
 
     virtual const char *giveClassName() const { return "MKLPardisoSolver"; }
     virtual LinSystSolverType giveLinSystSolverType() const { return ST_MKLPardiso; }
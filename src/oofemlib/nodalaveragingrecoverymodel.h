@@ -75,6 +75,19 @@ public:
 
     virtual const char *giveClassName() const { return "NodalAveragingRecoveryModel"; }
 
+protected:
+    virtual int computeMultipleValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
+    /**
+     * Averages the summed element values and stores them.
+     * @param answer Nodal table to update.
+     * @param lhs Sums of element values in region nodes, overwritten by averages.
+     * @param regionDofMansConnectivity Number of contributions in region nodes.
+     * @param regionNodalNumbers Array containing for each dofManager its local region number.
+     * @param regionValSize Size of dofMan record.
+     */
+    void averageValues(std :: map< int, FloatArray > &answer, FloatArray &lhs, const IntArray &regionDofMansConnectivity,
+                       const IntArray &regionNodalNumbers, int regionValSize);
+
 private:
 #ifdef __PARALLEL_MODE
     void initCommMaps();
@@ -77,6 +77,10 @@ protected:
     InternalStateType valType;
     /// Time stamp of recovered values.
     StateCounterType stateCounter;
+    /// Map of nodal values of several internal variables (recovered by recoverMultipleValues), the type is the key.
+    std :: map< InternalStateType, std :: map< int, FloatArray > >multiNodalValList;
+    /// Time stamp of values in multiNodalValList.
+    StateCounterType multiStateCounter;
     Domain *domain;
 
 #ifdef __PARALLEL_MODE
@@ -102,6 +106,16 @@ public:
      * @param tStep Time step.
      */
     virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Recovers the nodal values of several internal variables at once.
+     * The recovered values are kept until the solution state changes or the receiver is cleared,
+     * so the types already recovered are not recovered again.
+     * @param elementSet Set of elements defining the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     * @return Nonzero if o.k.
+     */
+    int recoverMultipleValues(Set elementSet, const IntArray &types, TimeStep *tStep);
     /**
      * Clears the receiver's nodal table.
      * @return nonzero if o.k.
@@ -114,6 +128,14 @@ public:
      * @return Nonzero if values are defined, zero otherwise.
      */
     int giveNodalVector(const FloatArray * &ptr, int node);
+    /**
+     * Returns vector of recovered values of given type for given node (see recoverMultipleValues).
+     * @param ptr Pointer to recovered values at node, NULL if not present.
+     * @param node Node number.
+     * @param type Type of internal variable.
+     * @return Nonzero if values are defined, zero otherwise.
+     */
+    int giveNodalVector(const FloatArray * &ptr, int node, InternalStateType type);
     /**
      * Returns the region record size. Available after recovery.
      * @param reg Virtual region id.
@@ -144,6 +166,23 @@ protected:
      */
     int updateRegionRecoveredValues(const IntArray &regionNodalNumbers,
                                     int regionValSize, const FloatArray &rhs);
+    /**
+     * Same as above, but the values are stored in the given nodal table.
+     * @param answer Nodal table to update.
+     */
+    int updateRegionRecoveredValues(std :: map< int, FloatArray > &answer, const IntArray &regionNodalNumbers,
+                                    int regionValSize, const FloatArray &rhs);
+
+    /**
+     * Recovers the nodal values of given internal variables and stores them in multiNodalValList.
+     * The default implementation recovers the variables one by one, the derived classes evaluate
+     * the element contributions of all the variables in a single sweep over the elements.
+     * @param elementSet Set of elements defining the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     * @return Nonzero if o.k.
+     */
+    virtual int computeMultipleValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // nodalrecoverymodel_h
@@ -69,6 +69,11 @@
 #define _IFT_NRSolver_maxinc "maxinc"
 #define _IFT_NRSolver_forceScale "forcescale"
 #define _IFT_NRSolver_forceScaleDofs "forcescaledofs"
+#define _IFT_NRSolver_inexactNewton "inexactnewton"
+#define _IFT_NRSolver_forcingEtaMax "etamax"
+#define _IFT_NRSolver_forcingEtaMin "etamin"
+#define _IFT_NRSolver_forcingGamma "ewgamma"
+#define _IFT_NRSolver_forcingAlpha "ewalpha"
 //@}
 
 namespace oofem {
@@ -91,6 +96,13 @@ class EngngModel;
  * that is, the required condition, but the whole system remains symmetric and minimal
  * changes are necessary in the computational sequence.
  * The above artifice has been introduced by Payne and Irons.
+ *
+ * Optionally, the inexact Newton mode can be activated for iterative linear solvers.
+ * The relative tolerance of the linear solver (forcing term) is then adapted in each iteration
+ * using the Eisenstat-Walker choice 2:
+ * @f$ \eta_k = \gamma (\Vert r_k \Vert / \Vert r_{k-1} \Vert)^\alpha @f$,
+ * safeguarded by @f$ \gamma\eta_{k-1}^\alpha @f$ and bounded to the interval @f$ [\eta_{min}, \eta_{max}] @f$.
+ * Far from the solution the linear system is solved only roughly, which saves linear solver iterations.
  */
 class OOFEM_EXPORT NRSolver : public SparseNonLinearSystemNM
 {
@@ -157,6 +169,16 @@ protected:
     std :: map<int, double> dg_forceScale;
 
     double maxIncAllowed;
+
+    /// Flag indicating whether to use inexact Newton (adaptive linear solver tolerance).
+    bool inexactNewtonFlag;
+    /// Upper bound of the forcing term.
+    double forcingEtaMax;
+    /// Lower bound of the forcing term.
+    double forcingEtaMin;
+    /// Eisenstat-Walker parameters.
+    double forcingGamma, forcingAlpha;
+
 public:
     NRSolver(Domain * d, EngngModel * m);
     virtual ~NRSolver();
@@ -205,6 +227,16 @@ protected:
      */
     bool checkConvergence(FloatArray &RT, FloatArray &F, FloatArray &rhs, FloatArray &ddX, FloatArray &X,
                           double RRT, const FloatArray &internalForcesEBENorm, int nite, bool &errorOutOfRange);
+
+    /**
+     * Computes the forcing term (relative tolerance of the linear solver) for inexact Newton iteration.
+     * @param nite Iteration number.
+     * @param rhsNorm Norm of current residual.
+     * @param rhsNormOld Norm of the residual in previous iteration.
+     * @param etaOld Previous forcing term.
+     * @return New forcing term.
+     */
+    double computeForcingTerm(int nite, double rhsNorm, double rhsNormOld, double etaOld);
 };
 } // end namespace oofem
 #endif // nrsolver_h
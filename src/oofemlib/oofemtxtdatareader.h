@@ -39,6 +39,7 @@
 #include "oofemtxtinputrecord.h"
 
 #include <fstream>
+#include <vector>
 
 namespace oofem {
 /**
@@ -48,27 +49,44 @@ namespace oofem {
  * There is no check for record type requested, it is assumed that records are
  * written in correct order, which determined by the coded sequence of
  * component initialization and described in input manual.
+ *
+ * Besides the text format, the reader accepts a binary fast-load format (recognized by its header),
+ * which stores the records with resolved includes, already converted to lower case and split into tokens.
+ * The binary file is produced from the text input by writeBinary (see the -wb option of oofem).
+ * With OpenMP, the records of text input are tokenized in parallel, as well as the records of binary input are decoded.
  */
 class OOFEM_EXPORT OOFEMTXTDataReader : public DataReader
 {
 protected:
     std :: string dataSourceName;
-    std :: list< OOFEMTXTInputRecord > recordList;
+    std :: vector< OOFEMTXTInputRecord > recordList;
 
     /// Keeps track of the current position in the list
-    std :: list< OOFEMTXTInputRecord > :: iterator it;
+    std :: vector< OOFEMTXTInputRecord > :: iterator it;
 
 public:
     /// Constructor.
     OOFEMTXTDataReader(std :: string inputfilename);
+    /**
+     * Copy constructor. Copies the already parsed records of x (positioned at the first record),
+     * which is a cheap way of instantiating the same input many times (e.g. subscale problems).
+     */
     OOFEMTXTDataReader(const OOFEMTXTDataReader & x);
     virtual ~OOFEMTXTDataReader();
 
     virtual InputRecord *giveInputRecord(InputRecordType, int recordId);
     virtual bool peakNext(const std :: string &keyword);
+    virtual bool hasPersistentRecords() const { return true; }
     virtual void finish();
     virtual std :: string giveReferenceName() const { return dataSourceName; }
 
+    /**
+     * Writes all records into binary fast-load file.
+     * Should be called before any record is read.
+     * @param filename Name of the binary file.
+     */
+    void writeBinary(const std :: string &filename) const;
+
 protected:
     /**
      * Reads one line from inputStream
@@ -77,6 +95,10 @@ protected:
     bool giveLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
     /// Reads one line from stream.
     bool giveRawLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
+    /// Checks whether the given file is in the binary fast-load format.
+    static bool isBinaryInput(const std :: string &filename);
+    /// Reads the records from binary fast-load file.
+    void readBinary();
 };
 } // end namespace oofem
 #endif // oofemtxtdatareader_h
@@ -67,6 +67,8 @@ public:
     OOFEMTXTInputRecord();
     /// Constructor. Creates the input record corresponding to given string.
     OOFEMTXTInputRecord(int linenumber, std :: string source);
+    /// Constructor. Creates the input record corresponding to given string, which has already been split into tokens.
+    OOFEMTXTInputRecord(int linenumber, std :: string source, std :: vector< std :: string >tokens);
     /// Copy constructor.
     OOFEMTXTInputRecord(const OOFEMTXTInputRecord &);
     /// Destructor.
@@ -105,6 +107,9 @@ public:
     void report_error(const char *_class, const char *proc, InputFieldType id,
                       IRResultType result, const char *file, int line) override;
     void setLineNumber(int lineNumber) { this->lineNumber = lineNumber; }
+    int giveLineNumber() const { return this->lineNumber; }
+    /// Returns the tokens of the record.
+    const std :: vector< std :: string > &giveTokens() const { return tokenizer.giveTokens(); }
 
 protected:
     int giveKeywordIndx(const char *kwd);
@@ -37,10 +37,103 @@
 
 #include "oofemcfg.h"
 
+#include <vector>
+#include <string>
+
 namespace oofem {
 #define Parser_CMD_LENGTH 1024
 #define Parser_TBLSZ 23
 
+/**
+ * Expression compiled by Parser into a flat tree of operations with variables stored in numbered slots.
+ * Compiling once and evaluating many times avoids tokenizing and hashing variable names on every call.
+ * The program is a sequence of statements (separated by ';' in the source string); the value of the last
+ * statement is the result. Slot values are supplied by the caller, so one compiled expression
+ * can be evaluated concurrently with separate slot arrays.
+ */
+class OOFEM_EXPORT CompiledExpression
+{
+public:
+    enum OpType {
+        OP_Const, OP_Var, OP_Assign, OP_Neg,
+        OP_Add, OP_Sub, OP_Mul, OP_Div, OP_Pow, OP_Eq, OP_Le, OP_Lt, OP_Ge, OP_Gt,
+        OP_Sqrt, OP_Sin, OP_Cos, OP_Tan, OP_Atan, OP_Asin, OP_Acos, OP_Exp, OP_Log, OP_Heaviside
+    };
+
+protected:
+    struct Node {
+        OpType op;
+        /// Operand node indices (-1 if unused).
+        int a, b;
+        /// Variable slot for OP_Var, OP_Assign and OP_Heaviside (slot of "t").
+        int slot;
+        double value;
+    };
+    std :: vector< Node >nodes;
+    /// Root node of each statement, evaluated in order.
+    std :: vector< int >statements;
+    /// Names of variable slots.
+    std :: vector< std :: string >slotNames;
+    /// Nonzero for slots that are read before being assigned, i.e. those that must be supplied by the caller.
+    std :: vector< char >freeSlots;
+    /// Nonzero for slots assigned so far (used while compiling).
+    std :: vector< char >assignedSlots;
+
+public:
+    CompiledExpression() { }
+
+    /// Removes all statements and variables.
+    void clear();
+    /// Returns true if nothing has been compiled.
+    bool isEmpty() const { return statements.empty(); }
+
+    /// Returns the number of variable slots the caller has to provide for evaluation.
+    int giveNumberOfSlots() const { return (int)slotNames.size(); }
+    /// Returns the slot of given variable, or -1 if the expression does not use it.
+    int giveSlot(const std :: string &name) const;
+    /// Returns the name of given slot.
+    const std :: string &giveSlotName(int slot) const { return slotNames [ slot ]; }
+    /// Returns true if the slot has to be set by the caller before evaluation.
+    bool isFreeSlot(int slot) const { return freeSlots [ slot ] != 0; }
+
+    /**
+     * Evaluates the expression.
+     * @param slots Values of all slots, of size giveNumberOfSlots(). Free slots must be set by the caller,
+     * the remaining ones are overwritten by assignments in the expression.
+     */
+    double evaluate(double *slots) const;
+
+    /**
+     * Builds the symbolic derivative of the expression with respect to given variable.
+     * Variables assigned inside the expression are differentiated by the chain rule;
+     * other free variables are considered independent. Comparison operators and the Heaviside
+     * function are treated as piecewise constant.
+     * @param answer Derivative expression, using the same free slots as the receiver.
+     * @param var Name of the variable.
+     */
+    void differentiate(CompiledExpression &answer, const std :: string &var) const;
+
+    ///@name Construction, used by Parser.
+    //@{
+    int giveOrInsertSlot(const std :: string &name);
+    int addConstant(double v);
+    int addVariable(int slot);
+    int addAssign(int slot, int a);
+    int addUnary(OpType op, int a);
+    int addBinary(OpType op, int a, int b);
+    int addHeaviside(int tslot, int a);
+    void addStatement(int root) { statements.push_back(root); }
+    //@}
+
+protected:
+    double evaluateNode(int i, double *slots) const;
+    bool isConstant(int i, double v) const { return nodes [ i ].op == OP_Const && nodes [ i ].value == v; }
+    bool containsAssign(int i) const;
+    int addNode(OpType op, int a, int b, int slot, double value);
+    int giveDerivative(int i, int var, std :: vector< int > &dslots);
+};
+
+
 /**
  * Class for evaluating mathematical expressions in strings.
  * Strings should be in MATLAB syntax. The parser understands variable names with values set by "x=expression;"
@@ -66,6 +159,11 @@ public:
     }
 
     double eval(const char *string, int &err);
+    /**
+     * Compiles the expression for repeated evaluation.
+     * Variables not assigned in the expression become free slots of the answer.
+     */
+    void   compile(const char *string, CompiledExpression &answer, int &err);
     void   reset();
 
 private:
@@ -95,6 +193,10 @@ private:
     double term(bool get);
     double prim(bool get);
     double agr(bool get);
+    int cexpr(bool get, CompiledExpression &e);
+    int cterm(bool get, CompiledExpression &e);
+    int cprim(bool get, CompiledExpression &e);
+    int cagr(bool get, CompiledExpression &e);
     Token_value get_token();
 };
 } // end namespace oofem
@@ -50,6 +50,12 @@ class FloatMatrix;
  */
 class OOFEM_EXPORT PetscSolver : public SparseLinearSystemNM
 {
+protected:
+    /// Relative tolerance overriding the KSP settings (non-positive if not used).
+    double rtolOverride;
+    /// KSP relative tolerance in effect before the override was applied (negative if not overridden).
+    double rtolDefault;
+
 public:
     /**
      * Constructor.
@@ -61,6 +67,7 @@ public:
     virtual ~PetscSolver();
 
     virtual NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
+    virtual void setRelativeTolerance(double rtol) { rtolOverride = rtol; }
 
     /**
      * Solves the given linear system.
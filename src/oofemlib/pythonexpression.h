@@ -100,6 +100,12 @@ public:
     virtual void evaluate(FloatArray &answer, std :: map< std :: string, FunctionArgument > &valDict);
     virtual void evaluateVelocity(FloatArray &answer, std :: map< std :: string, FunctionArgument > &valDict);
     virtual void evaluateAcceleration(FloatArray &answer, std :: map< std :: string, FunctionArgument > &valDict);
+    /**
+     * Evaluates the expression once for all points. The variables "x" and "t" are memoryviews
+     * of shape (n, dim) and (n,) sharing memory with the arguments (numpy.asarray gives array views),
+     * and the result must be a sequence or buffer of n numbers.
+     */
+    virtual void evaluateAtPoints(FloatArray &answer, const std :: vector< FloatArray > &coords, const FloatArray &times);
     virtual double evaluateAtTime(double t);
     virtual double evaluateVelocityAtTime(double t);
     virtual double evaluateAccelerationAtTime(double t);
@@ -107,6 +107,7 @@ public:
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
     FloatArray *backSubstitutionWith(FloatArray &) const override;
+    FloatMatrix *backSubstitutionWith(FloatMatrix &) const override;
     void zero() override;
     /**
      * Splits the receiver to LDLT form,
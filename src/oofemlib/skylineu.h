@@ -82,6 +82,7 @@ public:
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
     FloatArray *backSubstitutionWith(FloatArray &) const override;
+    FloatMatrix *backSubstitutionWith(FloatMatrix &) const override;
     void zero() override;
     double &at(int i, int j) override;
     double at(int i, int j) const override;
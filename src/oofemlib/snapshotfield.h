@@ -0,0 +1,116 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef snapshotfield_h
+#define snapshotfield_h
+
+#include "field.h"
+#include "floatarray.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class IntArray;
+
+/**
+ * Field holding copies of the nodal values of another (source) field at the last few solution steps.
+ * It is used by StaggeredProblem in the concurrent mode, where the problems of one step are solved
+ * at the same time. The copies are taken between the steps, so the snapshot can be evaluated while
+ * the owner of the source field overwrites its own values.
+ *
+ * The snapshot is lagged by one step: the value at step n is given by the latest copy taken at a
+ * step before n. The incremental values and the velocities are given by the differences of the
+ * consecutive copies. The values between nodes are interpolated on the elements of the source domain.
+ */
+class OOFEM_EXPORT SnapshotField : public Field
+{
+protected:
+    /// Field, whose values are copied.
+    FieldPtr source;
+    /// Domain of the source field (need its dof managers and elements).
+    Domain *domain;
+    /// Maximum number of stored steps.
+    int historySize;
+    /// Numbers of the stored steps; the latest one is the last.
+    std :: vector< int >stepNumbers;
+    /// Target times of the stored steps.
+    std :: vector< double >stepTimes;
+    /// Dof manager values of the stored steps.
+    std :: vector< std :: vector< FloatArray > >values;
+
+public:
+    /**
+     * Constructor. Creates an empty snapshot of given field.
+     * @param src Source field.
+     * @param d Domain, where the source field is defined.
+     * @param nhist Number of stored steps.
+     */
+    SnapshotField(FieldPtr src, Domain * d, int nhist = 3);
+    virtual ~SnapshotField() { }
+
+    /**
+     * Copies the values of the source field at all dof managers of the domain.
+     * @param tStep Solution step, which has been completed by the owner of the source field.
+     */
+    void takeSnapshot(TimeStep *tStep);
+    /// Returns true if no copy has been taken yet.
+    bool isEmpty() const { return values.empty(); }
+    /// Returns the source field.
+    FieldPtr giveSourceField() { return source; }
+
+    int evaluateAt(FloatArray &answer, const FloatArray &coords, ValueModeType mode, TimeStep *tStep) override;
+    int evaluateAt(FloatArray &answer, DofManager *dman, ValueModeType mode, TimeStep *tStep) override;
+
+    void saveContext(DataStream &stream) override { }
+    void restoreContext(DataStream &stream) override { }
+
+    const char *giveClassName() const override { return "SnapshotField"; }
+
+protected:
+    /// Returns the index of the latest copy taken before given step (the first copy if there is none).
+    int giveSnapshotIndex(TimeStep *tStep);
+    /**
+     * Combines the stored values according to the value mode.
+     * @param answer Values of the dof managers combined with given weights.
+     * @param dmans Dof manager numbers.
+     * @param weights Weights of the dof managers.
+     * @param mode Value mode.
+     * @param tStep Solution step.
+     * @return Zero if ok, nonzero if the mode is not supported.
+     */
+    int combine(FloatArray &answer, const IntArray &dmans, const FloatArray &weights, ValueModeType mode, TimeStep *tStep);
+};
+} // end namespace oofem
+#endif // snapshotfield_h
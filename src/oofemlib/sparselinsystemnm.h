@@ -39,10 +39,10 @@
 #include "nmstatus.h"
 #include "linsystsolvertype.h"
 #include "sparsemtrxtype.h"
+#include "sparsemtrx.h"
 
 namespace oofem {
 class EngngModel;
-class SparseMtrx;
 class FloatArray;
 
 /**
@@ -57,6 +57,26 @@ class FloatArray;
  */
 class OOFEM_EXPORT SparseLinearSystemNM : public NumericalMethod
 {
+protected:
+    /// Instance id of the matrix, which factorization is kept by receiver (zero if none).
+    SparseMtrx :: SparseMtrxVersionType factorizedLhsId;
+    /// Version of the matrix, which factorization is kept by receiver.
+    SparseMtrx :: SparseMtrxVersionType factorizedLhsVersion;
+
+    /**
+     * Checks whether the factorization kept by receiver belongs to given matrix,
+     * i.e., the matrix is the same instance and it has not been changed since factorized.
+     * Solvers keeping the factorization can then perform only back substitution.
+     */
+    bool isFactorizationUpToDate(SparseMtrx &A) const {
+        return this->factorizedLhsId == A.giveInstanceId() && this->factorizedLhsVersion == A.giveVersion();
+    }
+    /// Records that receiver keeps the factorization of given matrix.
+    void setFactorizationUpToDate(SparseMtrx &A) {
+        this->factorizedLhsId = A.giveInstanceId();
+        this->factorizedLhsVersion = A.giveVersion();
+    }
+
 public:
     /// Constructor.
     SparseLinearSystemNM(Domain * d, EngngModel * m);
@@ -89,6 +109,17 @@ public:
      * @return Status of the solver.
      */
     virtual NM_Status solve(SparseMtrx &A, FloatMatrix &B, FloatMatrix &X);
+    /**
+     * Overrides the relative residual tolerance of the subsequent solves.
+     * Used by inexact Newton methods to adapt the linear solver accuracy to the nonlinear residual (forcing term).
+     * Only meaningful for iterative solvers, direct solvers ignore it.
+     * @param rtol Relative tolerance, non-positive value restores the tolerance given in input.
+     */
+    virtual void setRelativeTolerance(double rtol) { }
+    /**
+     * Discards the factorization kept by receiver (if any), the next solve will factorize the matrix again.
+     */
+    virtual void invalidateFactorization() { this->factorizedLhsId = 0; }
     /**
      * Returns the recommended sparse matrix type for this solver.
      */
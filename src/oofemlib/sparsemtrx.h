@@ -43,6 +43,7 @@
 #include "sparsemtrxtype.h"
 
 #include <memory>
+#include <atomic>
 
 namespace oofem {
 class EngngModel;
@@ -80,18 +81,32 @@ protected:
      * matrix, if there is no change;
      */
     SparseMtrxVersionType version;
+    /**
+     * Unique identification of receiver instance.
+     * Together with version, it identifies the matrix values, even if a new matrix is allocated
+     * at the address of a deleted one (used by solvers to reuse factorizations).
+     */
+    SparseMtrxVersionType instanceId;
+
+    /// Returns new unique instance identification.
+    static SparseMtrxVersionType giveNewInstanceId() {
+        static std :: atomic< SparseMtrxVersionType >counter(0);
+        return ++counter;
+    }
 
 public:
     /**
      * Constructor, creates (n,m) sparse matrix. Due to sparsity character of matrix,
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
-    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0), instanceId( giveNewInstanceId() ) { }
     /// Destructor
     virtual ~SparseMtrx() { }
 
     /// Return receiver version.
     SparseMtrxVersionType giveVersion() { return this->version; }
+    /// Returns unique identification of receiver instance.
+    SparseMtrxVersionType giveInstanceId() const { return this->instanceId; }
 
     /**
      * Checks size of receiver towards requested bounds.
@@ -252,6 +267,25 @@ public:
      * @return Pointer to y array.
      */
     virtual FloatArray *backSubstitutionWith(FloatArray &y) const { return NULL; }
+    /**
+     * Computes the solution of factorized system for several right hand sides at once.
+     * Solution matrix overwrites the right hand side matrix y.
+     * Receiver must be in factorized form.
+     * Default implementation performs the back substitution column by column.
+     * @param y Right hand sides on input (one per column), solutions on output.
+     * @return Pointer to y matrix, NULL if the back substitution is not supported.
+     */
+    virtual FloatMatrix *backSubstitutionWith(FloatMatrix &y) const {
+        FloatArray col;
+        for ( int i = 1; i <= y.giveNumberOfColumns(); ++i ) {
+            y.copyColumn(col, i);
+            if ( !this->backSubstitutionWith(col) ) {
+                return NULL;
+            }
+            y.setColumn(col, i);
+        }
+        return & y;
+    }
     /// Zeroes the receiver.
     virtual void zero() = 0;
 
@@ -63,10 +63,6 @@ class FloatMatrix;
 class OOFEM_EXPORT SpoolesSolver : public SparseLinearSystemNM
 {
 private:
-    /// Last mapped LHS matrix
-    SparseMtrx *Lhs;
-    /// Last mapped matrix version
-    SparseMtrx :: SparseMtrxVersionType lhsVersion;
     int msglvl;
     FILE *msgFile;
     int msgFileCloseFlag;
@@ -86,6 +86,9 @@ public:
 
     virtual const char *giveClassName() const { return "SPRNodalRecoveryModel"; }
 
+protected:
+    virtual int computeMultipleValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
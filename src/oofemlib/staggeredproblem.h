@@ -38,6 +38,9 @@
 #include "engngm.h"
 #include "inputrecord.h"
 #include "floatarray.h"
+#include "field.h"
+
+#include <map>
 
 ///@name Input fields for StaggeredProblem
 //@{
@@ -58,10 +61,13 @@
 #define _IFT_StaggeredProblem_reqiterations "reqiterations"
 #define _IFT_StaggeredProblem_endoftimeofinterest "endoftimeofinterest"
 #define _IFT_StaggeredProblem_adaptivestepsince "adaptivestepsince"
+#define _IFT_StaggeredProblem_concurrent "concurrent"
+#define _IFT_StaggeredProblem_threads "threads"
 //@}
 
 namespace oofem {
 class Function;
+class SnapshotField;
 
 /**
  * Implementation of general sequence (staggered) problem. The problem consists in sequence of
@@ -82,6 +88,12 @@ class Function;
  * generation the solution steps. Therefore, the solution step specification, as well as
  * relevant meta step attributes are specified at master level.
  *
+ * In the concurrent mode, the slave problems of each step are solved at the same time (each one by
+ * a separate thread group, if OpenMP is available). The fields exported by the slaves are then replaced
+ * in the field manager by their snapshots taken at the end of the previous step, so the coupling is
+ * lagged by one step. The first step is always solved sequentially. The slave problems must not
+ * change the solution step (e.g. by adaptive time stepping) in this mode.
+ *
  * @note To avoid confusion,
  * the slaves are treated in so-called maintained mode. In this mode, the attributes and
  * meta step attributes are taken from the master. The local attributes, even if specified,
@@ -134,6 +146,15 @@ protected:
 
     double prevStepLength;
     double currentStepLength;
+
+    /// Flag indicating that the slave problems are solved concurrently, with the coupling lagged by one step.
+    bool concurrent;
+    /// Number of threads of each slave problem in the concurrent mode (empty for default).
+    IntArray threadGroups;
+    /// Number of slave problem exporting the field of given type.
+    std :: map< FieldType, int >fieldOwners;
+    /// Snapshots of the exported fields used in the concurrent mode.
+    std :: vector< std :: shared_ptr< SnapshotField > >fieldSnapshots;
     
 
 public:
@@ -218,6 +239,12 @@ public:
 
 protected:
     int instanciateSlaveProblems();
+    /**
+     * Updates the snapshots of the fields exported by the slave problems.
+     * At the first call, the snapshots are created and registered in the field manager instead of the exported fields.
+     * @param tStep Completed solution step.
+     */
+    void updateFieldSnapshots(TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // staggeredproblem_h
@@ -62,6 +62,10 @@ public:
     int giveNumberOfTokens();
     /// Returns pointer to i-th token.
     const char *giveToken(int i);
+    /// Sets already tokenized record (used when reading pre-tokenized input).
+    void setTokens(std :: vector< std :: string >t) { tokens = std :: move(t); }
+    /// Returns all tokens.
+    const std :: vector< std :: string > &giveTokens() const { return tokens; }
     //std::string giveToken(int i);
 
 protected:
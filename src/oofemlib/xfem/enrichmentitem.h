@@ -225,6 +225,15 @@ public:
 
     const std :: unordered_map< int, NodeEnrichmentType > &giveEnrNodeMap() const { return mNodeEnrMarkerMap; }
 
+    /**
+     * Checks if the enrichment of an element may have changed since the last call to clearChangedElements().
+     * Enrichment items that do not keep track of their updates report every element as changed.
+     * @param iElIndex Element number.
+     */
+    virtual bool isElementChanged(int iElIndex) const { return true; }
+    /// Forgets which elements have been changed by the previous updates.
+    virtual void clearChangedElements() { }
+
     virtual void giveBoundingSphere(FloatArray &oCenter, double &oRadius) = 0;
 
     EnrichmentFront *giveEnrichmentFrontStart() { return mpEnrichmentFrontStart; }
@@ -41,6 +41,8 @@
 #include "geometry.h"
 
 #include <memory>
+#include <unordered_set>
+#include <array>
 
 namespace oofem {
 class XfemManager;
@@ -71,6 +73,9 @@ public:
 
     void updateLevelSets(XfemManager &ixFemMan);
 
+    virtual bool isElementChanged(int iElIndex) const;
+    virtual void clearChangedElements() { mChangedElements.clear(); }
+
     virtual void evaluateEnrFuncInNode(std :: vector< double > &oEnrFunc, const Node &iNode) const;
 
     virtual void evaluateEnrFuncAt(std :: vector< double > &oEnrFunc, const FloatArray &iGlobalCoord, const FloatArray &iLocalCoord, int iNodeInd, const Element &iEl) const;
@@ -100,6 +105,25 @@ public:
 
 protected:
     std :: unique_ptr< BasicGeometry > mpBasicGeometry;
+
+    /**
+     * Checks if the last level set update can have changed how the interface cuts the element,
+     * i.e. if the level sets changed in one of its nodes or if the element is close to a moved tip.
+     */
+    bool isAffectedByUpdate(Element &iEl) const;
+
+    /// Nodes where the normal level set or the sign of the tangential level set changed in the last update.
+    std :: unordered_set< int >mChangedLevelSetNodes;
+    /// Boxes (xmin, ymin, xmax, ymax) spanning the old and the new position of the tips moved in the last update.
+    std :: vector< std :: array< double, 4 > >mMovedTipBoxes;
+    /// Tip coordinates at the last level set update.
+    std :: vector< FloatArray >mTipCoords;
+    /// Elements cut by the interface and elements covered by the last node marker update.
+    std :: unordered_set< int >mCutElements, mMarkedElements;
+    /// Elements whose enrichment may have changed since the last call to clearChangedElements.
+    std :: unordered_set< int >mChangedElements;
+    /// Set after the first update, before that every element is considered as changed.
+    bool mTrackChanges;
 };
 } /* namespace oofem */
 
@@ -79,6 +79,12 @@ public:
     /// Flag that tells if plane stress or plane strain is assumed
     bool mUsePlaneStrain;
 
+    /// Result of the last integration rule update, returned as long as the enrichment of the element does not change.
+    bool mIntRulePartitioned;
+    /// Intersection signature the current integration rule was computed for.
+    std :: vector< double >mIntRuleSignature;
+    bool mIntRuleSignatureValid;
+
     virtual const char *giveClassName() const { return "XfemElementInterface"; }
     std :: string errorInfo(const char *func) const { return std :: string( giveClassName() ) + func; }
 
@@ -120,6 +126,19 @@ public:
     /// Updates integration rule based on the triangulation.
     virtual bool XfemElementInterface_updateIntegrationRule();
 
+    /**
+     * Computes a signature of the interfaces inside the element, i.e. the enrichment items enriching
+     * the element, their level sets in the element nodes, their intersection points with the element
+     * edges and the tip coordinates. The subdivision of the element only depends on this signature,
+     * so the integration rule needs to be recomputed only if the signature changes.
+     */
+    void XfemElementInterface_computeIntersectionSignature(std :: vector< double > &oSignature, const std :: vector< int > &iEnrichingEIs);
+    /**
+     * Checks if the current integration rule was computed for the given signature.
+     * Otherwise, the signature is stored for the new rule.
+     */
+    bool XfemElementInterface_isIntegrationRuleCached(std :: vector< double > &ioSignature);
+
     /// Returns an array of array of points. Each array of points defines the points of a subregion of the element.
     virtual void XfemElementInterface_prepareNodesForDelaunay(std :: vector< std :: vector< FloatArray > > &oPointPartitions, double &oCrackStartXi, double &oCrackEndXi, int iEnrItemIndex, bool &oIntersection);
     virtual void XfemElementInterface_prepareNodesForDelaunay(std :: vector< std :: vector< FloatArray > > &oPointPartitions, double &oCrackStartXi, double &oCrackEndXi, const Triangle &iTri, int iEnrItemIndex, bool &oIntersection);
@@ -145,6 +145,12 @@ protected:
     std :: vector< std :: vector< int > >mNodeEnrichmentItemIndices;
     std :: unordered_map< int, std :: vector< int > >mElementEnrichmentItemIndices;
 
+    /**
+     * Flags for elements whose enrichment may have changed since they last updated
+     * their integration rules, indexed by element place in array - 1.
+     */
+    std :: vector< bool >mElementIntRuleOutdated;
+
     /**
      * Keep track of enrichment items that may assign a different
      * material to some Gauss points.
@@ -248,6 +254,14 @@ public:
     const std :: vector< int > &giveNodeEnrichmentItemIndices(int iNodeIndex) const { return mNodeEnrichmentItemIndices [ iNodeIndex - 1 ]; }
     void giveElementEnrichmentItemIndices(std :: vector< int > &oElemEnrInd, int iElementIndex) const;
 
+    /**
+     * Checks if the integration rule of an element has to be recomputed, i.e. if the enrichment
+     * of the element may have changed since the element last updated its integration rule.
+     */
+    bool isElementIntegrationRuleOutdated(int iElementIndex) const;
+    /// Marks the integration rule of an element as consistent with the current enrichment.
+    void setElementIntegrationRuleUpdated(int iElementIndex);
+
     const std :: vector< int > &giveMaterialModifyingEnrItemIndices() const { return mMaterialModifyingEnrItemIndices; }
 };
 } // end namespace oofem
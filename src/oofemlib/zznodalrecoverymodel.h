@@ -76,6 +76,19 @@ public:
 
     virtual const char *giveClassName() const { return "ZZNodalRecoveryModel"; }
 
+protected:
+    virtual int computeMultipleValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
+    /**
+     * Solves the lumped system for nodal values and stores them.
+     * @param answer Nodal table to update.
+     * @param lhs Lumped NN matrix of region nodes.
+     * @param rhs Assembled element contributions, one column for each component.
+     * @param regionNodalNumbers Array containing for each dofManager its local region number.
+     * @param regionDofMans Number of region dofManagers.
+     */
+    void computeNodalValues(std :: map< int, FloatArray > &answer, const FloatArray &lhs, const FloatMatrix &rhs,
+                            const IntArray &regionNodalNumbers, int regionDofMans);
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -0,0 +1,128 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef contactdefinitionnode2segment_h
+#define contactdefinitionnode2segment_h
+
+#include "contact/contactdefinition.h"
+
+#include <vector>
+#include <array>
+
+///@name Input fields for _IFT_ContactDefinitionNode2Segment
+//@{
+#define _IFT_ContactDefinitionNode2Segment_Name "cdef_node2segment"
+#define _IFT_ContactDefinitionNode2Segment_SlaveNodes "slavenodes"
+#define _IFT_ContactDefinitionNode2Segment_MasterSet "masterset"
+#define _IFT_ContactDefinitionNode2Segment_PenaltyN "penaltyn"
+#define _IFT_ContactDefinitionNode2Segment_Area "area"
+#define _IFT_ContactDefinitionNode2Segment_SearchRadius "searchradius"
+//@}
+
+namespace oofem {
+class DofManager;
+class Node2SegmentContact;
+
+/**
+ * Node to segment penalty contact with automatic contact search (2D).
+ * Instead of listing contact pairs in the input, each slave node is tested against all
+ * element boundaries of the master set. The search is split into
+ * - a broad phase, where the master segments are stored in a bounding volume hierarchy
+ *   of axis aligned boxes built from the deformed configuration. The boxes are refitted
+ *   every search and the tree topology is only rebuilt once the master nodes have moved
+ *   more than the average segment length since the last build;
+ * - a narrow phase, where the slave node is projected onto the candidate segments
+ *   returned by the tree and the closest one becomes the active segment of its contact element.
+ * The search is repeated every time the contact forces are evaluated (i.e. each iteration),
+ * the slave nodes are processed in parallel.
+ *
+ * Only straight segments are supported; boundaries of higher order elements are
+ * approximated by the chord between their end nodes.
+ */
+class OOFEM_EXPORT ContactDefinitionNode2Segment : public ContactDefinition
+{
+protected:
+    struct BVHNode {
+        std :: array< double, 4 >box; ///< xmin, ymin, xmax, ymax
+        int left, right; ///< Children (-1 for leaves).
+        int segment; ///< Segment index for leaves (-1 for interior nodes).
+    };
+
+    int masterSet;
+    double epsN;
+    double area;
+    double searchRadius;
+
+    std :: vector< Node2SegmentContact * >slaves;
+    /// Unique master nodes and their deformed positions.
+    std :: vector< DofManager * >masterNodes;
+    std :: vector< std :: array< double, 2 > >masterCoords;
+    /// Positions of the master nodes when the tree topology was built.
+    std :: vector< std :: array< double, 2 > >buildCoords;
+    /// Master segments as indices into masterNodes.
+    std :: vector< std :: array< int, 2 > >segments;
+    std :: vector< BVHNode >tree;
+    double rebuildTol;
+
+    void setupSegments();
+    void updateMasterCoordinates(TimeStep *tStep);
+    int buildTree(std :: vector< int > &segs, int start, int end);
+    void refitTree();
+    void searchPairs(TimeStep *tStep);
+
+public:
+    /// Constructor.
+    ContactDefinitionNode2Segment(ContactManager *cMan);
+    /// Destructor.
+    virtual ~ContactDefinitionNode2Segment() { }
+
+    virtual IRResultType initializeFrom(InputRecord *ir);
+
+    virtual void computeContactForces(FloatArray &answer, TimeStep *tStep, ValueModeType mode,
+                                      const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms);
+    virtual void computeContactTangent(SparseMtrx &answer, TimeStep *tStep,
+                                       const UnknownNumberingScheme &r_s, const UnknownNumberingScheme &c_s);
+
+    /**
+     * Collects the indices of all master segments whose bounding box contains the given point
+     * enlarged by the search radius.
+     */
+    void giveCandidateSegments(std :: vector< int > &answer, double x, double y);
+
+    virtual const char *giveClassName() const { return "ContactDefinitionNode2Segment"; }
+    virtual const char *giveInputRecordName() const { return _IFT_ContactDefinitionNode2Segment_Name; }
+};
+} // end namespace oofem
+#endif // contactdefinitionnode2segment_h
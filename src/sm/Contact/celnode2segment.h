@@ -0,0 +1,91 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef celnode2segment_h
+#define celnode2segment_h
+
+#include "contact/contactelement.h"
+
+namespace oofem {
+class DofManager;
+
+/**
+ * Penalty contact between a slave node and a straight master segment (2D).
+ * The active segment, the closest point parameter and the normal are not fixed at input
+ * but assigned by the owning contact definition after each contact search, which allows
+ * the slave node to slide along the master boundary.
+ * The variation of the normal is neglected in the tangent.
+ */
+class OOFEM_EXPORT Node2SegmentContact : public ContactElement
+{
+private:
+    DofManager *slaveNode;
+    /// End nodes of the currently active master segment (NULL if no segment was found).
+    DofManager *segmentNodes [ 2 ];
+    /// Parameter of the closest point on the active segment, in [0, 1].
+    double xi;
+    /// Outward unit normal of the active segment.
+    FloatArray normal;
+    /// Normal gap computed by the last contact search.
+    double gap;
+
+    double area; ///< The area associated with the slave node.
+    double epsN; ///< Penalty stiffness.
+
+public:
+    /// Constructor.
+    Node2SegmentContact(DofManager *slave, double epsN, double area);
+    /// Destructor.
+    virtual ~Node2SegmentContact() { }
+
+    DofManager *giveSlaveNode() { return this->slaveNode; }
+    /// Assigns the master segment found by the contact search together with the projection of the slave node.
+    void setActiveSegment(DofManager *a, DofManager *b, double xi, const FloatArray &normal, double gap);
+    /// Marks the slave node as having no master segment within the search radius.
+    void clearActiveSegment();
+    double giveGap() { return this->gap; }
+
+    /// Computes the derivative of the normal gap with respect to [slave, master a, master b] displacements.
+    void computeCvector(FloatArray &answer);
+
+    virtual void computeContactForces(FloatArray &answer, TimeStep *tStep, ValueModeType mode,
+                                      const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms);
+
+    virtual void computeContactTangent(FloatMatrix &answer, TimeStep *tStep);
+
+    virtual void giveLocationArray(IntArray &answer, const UnknownNumberingScheme &s);
+};
+} // end namespace oofem
+#endif // celnode2segment_h
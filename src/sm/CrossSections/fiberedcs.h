@@ -43,6 +43,8 @@
 #include "floatmatrix.h"
 #include "interface.h"
 
+#include <map>
+
 ///@name Input fields for FiberedCrossSection
 //@{
 #define _IFT_FiberedCrossSection_Name "fiberedcs"
@@ -54,6 +56,7 @@
 #define _IFT_FiberedCrossSection_fiberzcentrecoords "fiberzcentrecoords"
 #define _IFT_FiberedCrossSection_thick "thick"
 #define _IFT_FiberedCrossSection_width "width"
+#define _IFT_FiberedCrossSection_homogenizedstiffness "homogenizedstiffness"
 //@}
 
 namespace oofem {
@@ -85,6 +88,10 @@ class FiberedCrossSectionModelInterface;
  *   over thickness for plate bending problems)
  * - Returning RealStress state in gauss point and for given Stress mode.
  * - Returning a properties of cross section like thickness or area.
+ *
+ * Like in LayeredCrossSection, all fibers of a master point are evaluated in one pass
+ * and their stresses are integrated component-wise with precomputed fiber weights.
+ * The homogenizedstiffness option reuses the integrated beam stiffness while fibers stay elastic.
  */
 class FiberedCrossSection : public StructuralCrossSection
 {
@@ -97,6 +104,13 @@ protected:
     double width; ///< Total width.
     double area;  ///< Total area.
     FloatArray fiberYcoords, fiberZcoords;
+    FloatArray fiberWeights;  ///< Area (width times thickness) of each fiber.
+    FloatArray fiberYWeights; ///< Fiber area times its y-coordinate.
+    FloatArray fiberZWeights; ///< Fiber area times its z-coordinate.
+    /// Flag indicating that integrated stiffness is computed only once.
+    bool homogenizedStiffnessFlag;
+    /// Integrated stiffness matrices, keyed by response mode.
+    std :: map< int, FloatMatrix >homogenizedStiffness;
 
 public:
     FiberedCrossSection(int n, Domain * d) : StructuralCrossSection(n, d), fiberMaterials(), fiberThicks(), fiberWidths(),
@@ -105,6 +119,7 @@ public:
         thick = 0.;
         width = 0.;
         area = -1.0;
+        homogenizedStiffnessFlag = false;
     }
 
     virtual ~FiberedCrossSection()  { }
@@ -212,6 +227,11 @@ public:
 
 protected:
     double giveArea();
+
+    /// Integrates given stress component of all fibers with given fiber weights.
+    double integrateFiberComponent(const FloatMatrix &fiberStresses, int comp, const FloatArray &weights);
+    /// Checks whether homogenized stiffness can be reused for given response mode.
+    bool isHomogenizedStiffnessReusable(MatResponseMode rMode);
 };
 
 /**
@@ -44,6 +44,8 @@
 
 #include <vector>
 #include <memory>
+#include <map>
+#include <utility>
 
 ///@name Input fields for LayeredCrossSection
 //@{
@@ -57,6 +59,7 @@
 #define _IFT_LayeredCrossSection_midsurf "midsurf"
 #define _IFT_LayeredCrossSection_nintegrationpoints "nintegrationpoints"
 #define _IFT_LayeredCrossSection_initiationlimits "initiationlimits"
+#define _IFT_LayeredCrossSection_homogenizedstiffness "homogenizedstiffness"
 //@}
 
 namespace oofem {
@@ -87,6 +90,13 @@ class StructuralMaterial;
  *   over thickness for plate bending problems).
  * - Returning RealStress state in Gauss point and for given Stress mode.
  * - Returning a properties of cross section like thickness or area.
+ *
+ * The layers of a master point are evaluated in one pass; stresses of all layers are
+ * collected component-wise and integrated over the thickness afterwards, using the
+ * precomputed layer weights. With the homogenizedstiffness option the integrated
+ * stiffness is computed once and reused, which is valid as long as the layers
+ * stay elastic (elastic stiffness is always reused, tangent and secant only when
+ * all layers are made of linear elastic materials).
  */
 class LayeredCrossSection : public StructuralCrossSection
 {
@@ -103,6 +113,12 @@ protected:
     double midSurfaceXiCoordFromBottom;
     double totalThick;
     double area;
+    FloatArray layerWeights;       ///< Width times thickness of each layer.
+    FloatArray layerMomentWeights; ///< Layer weight times mid plane z-coord of each layer.
+    /// Flag indicating that integrated stiffness is computed only once.
+    bool homogenizedStiffnessFlag;
+    /// Integrated stiffness matrices, keyed by material mode and response mode.
+    std :: map< std :: pair< int, int >, FloatMatrix >homogenizedStiffness;
 
 public:
     LayeredCrossSection(int n, Domain * d) : StructuralCrossSection(n, d), layerMaterials(), layerThicks(), layerWidths()
@@ -110,6 +126,7 @@ public:
         numberOfLayers = 0;
         totalThick = 0.;
         area = -1.0;
+        homogenizedStiffnessFlag = false;
     }
 
     virtual ~LayeredCrossSection() { }
@@ -265,6 +282,27 @@ public:
 
 protected:
     double giveArea();
+
+    /**
+     * Evaluates stresses in all layers of given master point.
+     * @param answer Layer stresses, one row per layer (components of all layers are stored contiguously).
+     * @param nComp Number of stress components of the slave material mode.
+     * @param gp Master integration point.
+     * @param strain Generalized strain of master point.
+     * @param tStep Time step.
+     */
+    void computeLayerStresses(FloatMatrix &answer, int nComp, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
+    /// Integrates given stress component of all layers with given layer weights.
+    double integrateLayerComponent(const FloatMatrix &layerStresses, int comp, const FloatArray &weights);
+    /**
+     * Returns the homogenized stiffness, if it has been integrated already and can be reused.
+     * @return True if answer has been set.
+     */
+    bool giveHomogenizedStiffness(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp);
+    /// Stores the integrated stiffness for reuse (if enabled).
+    void storeHomogenizedStiffness(const FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp);
+    /// Checks whether homogenized stiffness can be reused for given response mode.
+    bool isHomogenizedStiffnessReusable(MatResponseMode rMode);
 };
 
 /**
@@ -42,6 +42,7 @@
 #define _IFT_DEIDynamic_Name "deidynamic"
 #define _IFT_DEIDynamic_dumpcoef "dumpcoef"
 #define _IFT_DEIDynamic_deltat "deltat"
+#define _IFT_DEIDynamic_targetdt "targetdt"
 //@}
 
 namespace oofem {
@@ -65,6 +66,10 @@ namespace oofem {
  * see diidynamic.h for difference.
  * So, when You specify initial conditions, you specify them in time step 0.
  *
+ * Selective mass scaling (parameter targetdt) adds mass to the elements, whose critical time step is
+ * below the target, so that their critical time step reaches the target. The added mass is reported
+ * per element set in the output file.
+ *
  * Tasks:
  * - Creating Numerical method for solving Ax=b
  * - Interfacing Numerical method to Elements
@@ -78,10 +83,12 @@ protected:
     FloatArray nextDisplacementVector;
     FloatArray displacementVector, velocityVector, accelerationVector;
     double dumpingCoef, deltaT;
+    /// Target time step of the selective mass scaling (zero if not used).
+    double targetDeltaT;
 
 public:
     DEIDynamic(int i, EngngModel * _master = NULL) : StructuralEngngModel(i, _master), massMatrix(), loadVector(),
-        nextDisplacementVector(), displacementVector(), velocityVector(), accelerationVector() {
+        nextDisplacementVector(), displacementVector(), velocityVector(), accelerationVector(), targetDeltaT(0.) {
         ndomains = 1;
     }
     virtual ~DEIDynamic();
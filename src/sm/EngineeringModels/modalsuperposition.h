@@ -0,0 +1,145 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef modalsuperposition_h
+#define modalsuperposition_h
+
+#include "sm/EngineeringModels/structengngmodel.h"
+#include "sparsegeneigenvalsystemnm.h"
+#include "sparsemtrxtype.h"
+#include "geneigvalsolvertype.h"
+#include "floatmatrix.h"
+#include "floatarray.h"
+
+///@name Input fields for ModalSuperposition
+//@{
+#define _IFT_ModalSuperposition_Name "modalsuperposition"
+#define _IFT_ModalSuperposition_deltat "deltat"
+#define _IFT_ModalSuperposition_nroot "nroot"
+#define _IFT_ModalSuperposition_rtolv "rtolv"
+#define _IFT_ModalSuperposition_stype "stype"
+#define _IFT_ModalSuperposition_dampingRatio "dampingratio"
+#define _IFT_ModalSuperposition_eta "eta"
+#define _IFT_ModalSuperposition_delta "delta"
+#define _IFT_ModalSuperposition_gamma "gamma"
+#define _IFT_ModalSuperposition_beta "beta"
+//@}
+
+namespace oofem {
+/**
+ * This class implements the solution of linear dynamic problems by modal superposition.
+ *
+ * In the first step, the lowest nroot eigenmodes @f$ \phi_i @f$ of @f$ K\phi = \omega^2 M\phi @f$ are computed
+ * by the same generalized eigenvalue solver as in EigenValueDynamic (parameters nroot, rtolv and stype).
+ * The problem is then projected on the modes, giving independent equations
+ * @f[ \ddot{q}_i + c_i \dot{q}_i + \omega_i^2 q_i = \phi_i^T f(t) / m_i, \quad m_i = \phi_i^T M \phi_i @f]
+ * with @f$ c_i = 2 \xi \omega_i + \eta + \delta \omega_i^2 @f$, where @f$ \xi @f$ is the modal damping ratio
+ * (parameter dampingratio) and @f$ \eta, \delta @f$ are the Rayleigh damping coefficients as in DIIDynamic.
+ * The modal equations are integrated by the Newmark method (default average acceleration, gamma = 0.5, beta = 0.25).
+ * With all the modes, the solution is identical to DIIDynamic with the Newmark scheme.
+ *
+ * Each step only assembles the load vector and projects it on the modes. The nodal unknowns are
+ * reconstructed from the modal coordinates on demand, and the element states are updated only in
+ * the steps, for which an output is requested (in all steps, if export modules are used).
+ *
+ * The initial conditions are projected on the modes. Only homogeneous Dirichlet boundary conditions are supported.
+ */
+class ModalSuperposition : public StructuralEngngModel
+{
+protected:
+    /// Eigenmodes (columns) and eigenvalues (omega^2).
+    FloatMatrix eigVec;
+    FloatArray eigVal;
+    /// Modal masses.
+    FloatArray modalMass;
+    /// Modal damping coefficients.
+    FloatArray modalDamping;
+    /// Modal displacements, velocities and accelerations.
+    FloatArray modalDisplacement, modalVelocity, modalAcceleration;
+    /// Load vector.
+    FloatArray loadVector;
+    /// Number of modes.
+    int numberOfRequiredEigenValues;
+    /// Relative tolerance of the eigenvalue solver.
+    double rtolv;
+    /// Time step.
+    double deltaT;
+    /// Modal damping ratio and Rayleigh damping coefficients.
+    double dampingRatio, eta, delta;
+    /// Newmark parameters.
+    double gamma, beta;
+    /// Flag indicating that the modes are to be computed.
+    bool initFlag;
+
+    SparseMtrxType sparseMtrxType;
+    GenEigvalSolverType solverType;
+    std :: unique_ptr< SparseGeneralEigenValueSystemNM > nMethod;
+
+public:
+    ModalSuperposition(int i, EngngModel * _master = NULL);
+    virtual ~ModalSuperposition();
+
+    virtual void solveYourselfAt(TimeStep *tStep);
+    virtual void updateYourself(TimeStep *tStep);
+
+    virtual double giveUnknownComponent(ValueModeType type, TimeStep *tStep, Domain *d, Dof *dof);
+    virtual IRResultType initializeFrom(InputRecord *ir);
+    virtual TimeStep *giveNextStep();
+    virtual NumericalMethod *giveNumericalMethod(MetaStep *mStep);
+
+    virtual contextIOResultType saveContext(DataStream &stream, ContextMode mode);
+    virtual contextIOResultType restoreContext(DataStream &stream, ContextMode mode);
+
+    virtual void printDofOutputAt(FILE *stream, Dof *iDof, TimeStep *tStep);
+
+    // identification
+    virtual const char *giveInputRecordName() const { return _IFT_ModalSuperposition_Name; }
+    virtual const char *giveClassName() const { return "ModalSuperposition"; }
+    virtual fMode giveFormulation() { return TL; }
+
+protected:
+    /**
+     * Computes the eigenmodes, the modal masses and damping and projects the initial conditions.
+     * @param tStep Time step.
+     */
+    void computeModes(TimeStep *tStep);
+    /**
+     * Tests whether the output of given step is requested by the output manager.
+     * The steps are always considered as output steps if export modules are present.
+     * @param tStep Time step.
+     */
+    bool isOutputStep(TimeStep *tStep);
+};
+} // end namespace oofem
+#endif // modalsuperposition_h
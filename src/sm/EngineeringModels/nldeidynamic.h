@@ -40,6 +40,9 @@
 #include "floatmatrix.h"
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
+#include "intarray.h"
+
+#include <vector>
 
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
@@ -52,6 +55,8 @@
 #define _IFT_NlDEIDynamic_tau "tau"
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
+#define _IFT_NlDEIDynamic_subcycling "subcycling"
+#define _IFT_NlDEIDynamic_targetdt "targetdt"
 //@}
 
 namespace oofem {
@@ -84,6 +89,24 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * The internal forces are assembled by a dedicated loop, since it is the dominant cost of each step.
+ * The element location arrays are computed once, and with OpenMP each thread assembles its elements
+ * into a private vector; the private vectors are summed afterwards, without any locking.
+ *
+ * Optionally, the step can be subcycled (parameter subcycling gives the maximum number of levels L).
+ * The critical time step of each element is estimated from its lumped mass and diagonal stiffness,
+ * and the elements are sorted into bins with time steps deltaT/2^L * 2^k, k=0..L. Each equation is
+ * integrated with the smallest time step of the connected elements, and the forces of the elements
+ * with larger time steps are held constant between their evaluations. All the equations are
+ * synchronized at the end of the step. The external loads are evaluated once per step and the
+ * time of the substeps is not passed to the elements, which has to be taken into account for rate
+ * dependent materials. Subcycling is not available with dynamic relaxation, contact, element loads
+ * and in parallel.
+ *
+ * Selective mass scaling (parameter targetdt) adds mass to the elements, whose critical time step is
+ * below the target, so that their critical time step reaches the target. The added mass is reported
+ * per element set in the output file.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -104,6 +127,8 @@ protected:
     double deltaT;
     /// Flag indicating the need for initialization.
     int initFlag;
+    /// Target time step of the selective mass scaling (zero if not used).
+    double targetDeltaT;
 
     // dynamic relaxation specific vars
     /// Flag indicating whether dynamic relaxation takes place.
@@ -121,6 +146,32 @@ protected:
     /// Product of p^tM^(-1)p; where p is reference load vector.
     double pMp;
 
+    ///@name Explicit assembly of internal forces
+    //@{
+    /// Location arrays of the elements, computed at the beginning of the analysis.
+    std :: vector< IntArray > elementLocations;
+    /// Thread-private internal force vectors.
+    std :: vector< FloatArray > threadInternalForces;
+    /// Flag indicating that the cached location arrays are valid.
+    bool explicitAssemblyInitFlag;
+    /// Flag indicating that elements carry loads, which requires the general assembly.
+    bool elementLoadsFlag;
+    //@}
+
+    ///@name Subcycling
+    //@{
+    /// Maximum number of subcycling levels (0 means no subcycling).
+    int subcycleLevels;
+    /// Number of substeps of the smallest level in one time step.
+    int numberOfSubsteps;
+    /// Critical time step estimates of the elements (zero if not available).
+    FloatArray elementCriticalDeltaT;
+    /// Subcycling levels of elements and equations; the time step of level k is 2^k substeps.
+    IntArray elementLevels, equationLevels;
+    /// Last evaluated internal forces of the elements (in global coordinate system).
+    std :: vector< FloatArray > elementForces;
+    //@}
+
     SparseMtrx *massMatrixConsistent;
     LinSystSolverType solverType;
     SparseMtrxType sparseMtrxType;
@@ -164,6 +215,34 @@ protected:
      * @param tStep Solution step.
      */
     void computeLoadVector(FloatArray &answer, ValueModeType mode, TimeStep *tStep);
+    /**
+     * Assembles the internal forces using the cached element location arrays.
+     * With OpenMP, the elements are processed in parallel and assembled into thread-private vectors.
+     * Falls back to StructuralEngngModel::giveInternalForces if elements carry their own loads.
+     * @param answer Internal force vector.
+     * @param tStep Solution step.
+     */
+    void giveExplicitInternalForces(FloatArray &answer, TimeStep *tStep);
+    /// Computes the element location arrays and checks for element loads.
+    void initializeExplicitAssembly();
+    /**
+     * Sorts the elements and equations into subcycling levels according to their critical time steps.
+     * The time step is reduced if the maximum number of levels does not suffice.
+     * @param maxDt Critical time step of the whole model.
+     * @param tStep Time step.
+     */
+    void initializeSubcycling(double maxDt, TimeStep *tStep);
+    /**
+     * Integrates the time step in substeps, each equation with the time step of its level.
+     * @param tStep Time step.
+     */
+    void solveSubcycledStep(TimeStep *tStep);
+    /**
+     * Evaluates the internal forces of the elements active in given substep.
+     * @param substep Substep number; all elements are evaluated in substep 0.
+     * @param tStep Time step.
+     */
+    void computeSubcycledElementForces(int substep, TimeStep *tStep);
     /**
      * Assembles the diagonal mass matrix of receiver.
      * Local or Global variant of zero mass elements replacement is performed.
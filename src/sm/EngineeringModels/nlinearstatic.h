@@ -52,6 +52,11 @@
 #define _IFT_NonLinearStatic_loadBalancingFlag "loadbalancingflag"
 #define _IFT_NonLinearStatic_forceloadBalancingFlag "forceloadbalancingflag"
 #define _IFT_NonLinearStatic_updateElasticStiffnessFlag "updateelasticstiffnessflag"
+#define _IFT_NonLinearStatic_reqIterations "reqiterations" ///< Desired number of iterations per step; enables adaptive stepping under direct control.
+#define _IFT_NonLinearStatic_dtMin "dtmin" ///< Minimum time increment in adaptive stepping.
+#define _IFT_NonLinearStatic_dtMax "dtmax" ///< Maximum time increment in adaptive stepping.
+#define _IFT_NonLinearStatic_dtGrowth "dtgrowth" ///< Maximum ratio between consecutive time increments in adaptive stepping.
+#define _IFT_NonLinearStatic_endTime "endtime" ///< Time at which the adaptive meta step ends (optional).
 //@}
 
 namespace oofem {
@@ -84,6 +89,13 @@ enum NonLinearStatic_controlType {
  * - Assembling tangent stiffness matrix.
  * - Interfacing Numerical method to Elements.
  * - Managing time steps.
+ *
+ * With direct control, the time increment can be adapted to the convergence history of the
+ * nonlinear solver (when reqiterations is given in the meta step record). The increment grows
+ * after steps converging in fewer than the required number of iterations and shrinks after slow
+ * convergence. Steps that fail to converge are discarded (the temporary state of the integration
+ * points is reset) and repeated with half of the increment. The meta step ends at endtime (if given)
+ * or after nsteps steps.
  */
 class NonLinearStatic : public LinearStatic
 {
@@ -119,6 +131,16 @@ protected:
     /// Intrinsic time increment.
     double deltaT;
 
+    ///@name Adaptive stepping
+    //@{
+    /// Desired number of iterations per step (zero if the step is not adaptive).
+    int reqIterations;
+    double dtMin, dtMax, dtGrowth;
+    double endTime;
+    /// Time increment proposed for the next step.
+    double adaptiveDeltaT;
+    //@}
+
    /**
      * The following parameter allows to specify how the reference load vector
      * is obtained from given totalLoadVector and initialLoadVector.
@@ -182,6 +204,8 @@ protected:
     virtual void assemble(SparseMtrx &answer, TimeStep *tStep, const MatrixAssembler &ma,
                           const UnknownNumberingScheme &, Domain *domain);
     void proceedStep(int di, TimeStep *tStep);
+    /// Solves the step with adaptive time increment, repeating it until the nonlinear solver converges.
+    void proceedAdaptiveStep(int di, TimeStep *tStep);
     virtual void updateLoadVectors(TimeStep *tStep);
     virtual void computeExternalLoadReactionContribution(FloatArray &reactions, TimeStep *tStep, int di);
     void assembleIncrementalReferenceLoadVectors(FloatArray &_incrementalLoadVector,
@@ -97,6 +97,15 @@ protected:
      * @param id Domain number.
      */
     void printReactionForces(TimeStep *tStep, int id, FILE *out);
+    /**
+     * Prints the mass added by selective mass scaling, summed over the element sets of the domain
+     * and in total. The masses are sums of the diagonal entries of the lumped element mass matrices.
+     * @param elementMass Original masses of the elements.
+     * @param addedMass Masses added to the elements.
+     * @param di Domain number.
+     * @param out Output stream.
+     */
+    void printAddedMassReport(const FloatArray &elementMass, const FloatArray &addedMass, int di, FILE *out);
 
     /**
      * Computes the contribution external loading to reaction forces in given domain. Default implementations adds the
@@ -160,8 +160,7 @@ protected:
     /// Evaluation of characteristic moduli of the non-aging Kelvin chain.
     virtual void computeCharCoefficients(FloatArray &answer, double tPrime, GaussPoint *gp, TimeStep *tStep);
 
-    /// Update of partial moduli of individual chain units
-    virtual void updateEparModuli(double tPrime, GaussPoint *gp, TimeStep *tStep);
+    virtual void giveEparModuli(FloatArray &answer, double tPrime, GaussPoint *gp, TimeStep *tStep);
 
     virtual void computeCharTimes();
 
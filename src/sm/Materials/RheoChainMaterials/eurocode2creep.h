@@ -106,8 +106,8 @@ protected:
     // to achieve a better approximation of the compliance function by the retardation spectrum
     double tau1;
 
-    /// stiffness of the zeroth Kelvin unit
-    double EspringVal;
+    /// Stiffness of the zeroth Kelvin unit obtained from the retardation spectrum, before multiplying by g(t') / c.
+    double zerothUnitSpectrumStiffness;
 
     // ELASTICITY + SHORT TERM + STRENGTH
     /// mean compressive strength at 28 days default - to be specified in units of the analysis (e.g. 30.e6 + stiffnessFacotr 1. or 30. + stiffnessFactor 1.e6)
@@ -173,6 +173,7 @@ protected:
 public:
     Eurocode2CreepMaterial(int n, Domain *d) : KelvinChainMaterial(n, d) {
         shType = EC2_NoShrinkage;
+        zerothUnitSpectrumStiffness = 0.;
     }
     virtual ~Eurocode2CreepMaterial() { }
 
@@ -234,6 +235,15 @@ protected:
     /// Evaluation of characteristic moduli of the Kelvin chain.
     virtual void computeCharCoefficients(FloatArray &answer, double tPrime, GaussPoint *gp, TimeStep *tStep);
 
+    /// Partial moduli depend on the equivalent age if the material is temperature dependent.
+    virtual double giveEparModuliAge(GaussPoint *gp, TimeStep *tStep);
+
+    /// Computes the factor g(t') / c multiplying all moduli obtained from the retardation spectrum.
+    double computeRetardationSpectrumCoefficient(double atTime, GaussPoint *gp, TimeStep *tStep);
+
+    /// Computes stiffness of the zeroth Kelvin unit (aging elastic spring with retardation time = 0).
+    double computeZerothUnitStiffness(double atTime, GaussPoint *gp, TimeStep *tStep);
+
     /// computes increment of drying shrinkage - the shrinkage strain is isotropic
     void computeIncrementOfDryingShrinkageVector(FloatArray &answer, GaussPoint *gp, double tNow, double tThen);
 
@@ -47,6 +47,8 @@
 #include "sm/Elements/structuralelement.h"
 #include "sm/Materials/structuralms.h"
 
+#include <atomic>
+
 ///@name Input fields for RheoChainMaterial
 //@{
 #define _IFT_RheoChainMaterial_n "n"
@@ -59,6 +61,9 @@
 #define _IFT_RheoChainMaterial_timefactor "timefactor"
 #define _IFT_RheoChainMaterial_talpha "talpha"
 #define _IFT_RheoChainMaterial_preCastingTimeMat "precastingtimemat"
+#define _IFT_RheoChainMaterial_eparcachesize "eparcachesize"
+#define _IFT_RheoChainMaterial_epargrid "epargrid"
+#define _IFT_RheoChainMaterial_approxrelaxation "approxrelaxation"
 //@}
 
 namespace oofem {
@@ -142,8 +147,31 @@ protected:
     double nu;
     /// Parameters for the lattice model
     double alphaOne, alphaTwo;
-    /// Time for which the partial moduli of individual units have been evaluated.
-    double EparValTime;
+    /// Partial moduli of individual units evaluated for given time of loading and equivalent age.
+    struct EparCacheEntry {
+        double tPrime;
+        double age;
+        FloatArray moduli;
+        /// Value of EparCacheCounter at the last use, the only member modified after the entry is stored.
+        mutable std :: atomic< long >lastUse;
+    };
+    /**
+     * Table of evaluated partial moduli, shared by all integration points. Stored entries are never modified
+     * and the slots are read and replaced atomically, so that the lookup does not need any lock.
+     */
+    std :: vector< std :: atomic< EparCacheEntry * > >EparCache;
+    /// Replaced entries of EparCache, deleted as soon as no lookup is running.
+    std :: vector< EparCacheEntry * >EparCacheRetired;
+    /// Number of running lookups in EparCache.
+    std :: atomic< int >EparCacheReaders;
+    /// Maximum number of entries in EparCache, least recently used entries are replaced.
+    int EparCacheSize;
+    /// Counter used to track the use of EparCache entries.
+    std :: atomic< long >EparCacheCounter;
+    /// Number of points per decade of the logarithmic time grid on which the partial moduli are interpolated (0 = no interpolation).
+    int EparGridDensity;
+    /// If true, the relaxation function is evaluated by the approximate formula of Bazant and Kim instead of solving the integral equation.
+    bool approximateRelaxation;
 
     /// Time from which the model should give a good approximation. Optional field. Default value is 0.1 [day].
     double begOfTimeOfInterest; // local one or taken from e-model
@@ -151,8 +179,6 @@ protected:
     double endOfTimeOfInterest; // local one or taken from e-model
     /// Associated linearElasticMaterial, with E = 1.
     LinearElasticMaterial *linearElasticMaterial;
-    /// Partial moduli of individual units.
-    FloatArray EparVal;
     //FloatArray relaxationTimes;
     /// Characteristic times of individual units (relaxation or retardation times).
     FloatArray charTimes;
@@ -332,19 +358,53 @@ protected:
      * @param tr Age of material when relaxation has begun ???
      * @param tSteps At which times the relaxation function will be evaluated.
      * @warning tSteps should be uniformly distributed in log time scale and relatively dense (100 intervals) in order to achieve a reasonable accuracy.
+     * @note The number of creep function evaluations grows quadratically with the number of times,
+     * if approximateRelaxation is set, computeApproximateRelaxationFunction is used instead.
      */
     void computeDiscreteRelaxationFunction(FloatArray &answer, const FloatArray &tSteps, double t0, double tr, GaussPoint *gp, TimeStep *tSte);
 
+    /**
+     * Evaluation of the relaxation function at given times using the approximate formula
+     * (Bazant and Kim, 1979)
+     * @f[
+     * R(t, t') = \frac{1 - \Delta_0}{J(t, t')} - \frac{0.115}{J(t, t - 1)} \left( \frac{J(t' + \xi, t')}{J(t, t - \xi)} - 1 \right),
+     * \quad \xi = \frac{t - t'}{2}, \quad \Delta_0 = 0.008
+     * @f]
+     * which requires only four creep function evaluations per time (times in days). For load durations
+     * shorter than one day, J(t, t') is used instead of J(t, t - 1). The result is an approximation
+     * of the numerical solution of computeDiscreteRelaxationFunction, not the same values.
+     * @param[out] answer Array with evaluated relaxation function.
+     * @param t0 Age of material when load is applied.
+     * @param tSteps At which times (measured from t0) the relaxation function will be evaluated.
+     */
+    void computeApproximateRelaxationFunction(FloatArray &answer, const FloatArray &tSteps, double t0, GaussPoint *gp, TimeStep *tStep);
+
     /// Evaluation of elastic compliance matrix for unit Young's modulus.
     void giveUnitComplianceMatrix(FloatMatrix &answer, GaussPoint *gp, TimeStep *tStep);
     /// Evaluation of elastic stiffness matrix for unit Young's modulus.
     void giveUnitStiffnessMatrix(FloatMatrix &answer, GaussPoint *gp, TimeStep *tStep);
 
-    /// Update of partial moduli of individual chain units
-    virtual void updateEparModuli(double tPrime, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Gives partial moduli of individual chain units for given time of loading.
+     * The moduli are evaluated by computeCharCoefficients only if they are not found in the table shared
+     * by all integration points of the receiver, optionally interpolating in logarithmic time.
+     * Can be called concurrently.
+     */
+    virtual void giveEparModuli(FloatArray &answer, double tPrime, GaussPoint *gp, TimeStep *tStep);
+
+    /**
+     * Gives the equivalent age which, together with the time of loading, determines the partial moduli
+     * (e.g. for temperature dependent aging). Returns zero if the moduli depend only on the time of loading.
+     */
+    virtual double giveEparModuliAge(GaussPoint *gp, TimeStep *tStep) { return 0.; }
 
-    /// Access to partial modulus of a given unit
-    double giveEparModulus(int iChain);
+    /**
+     * Looks up the partial moduli for exactly given time of loading and equivalent age, evaluating them if not found.
+     * The moduli are evaluated outside of any lock, so computeCharCoefficients must not modify the receiver.
+     */
+    void giveCachedEparModuli(FloatArray &answer, double tPrime, double age, GaussPoint *gp, TimeStep *tStep);
+    /// Deletes all entries of EparCache and resizes it to EparCacheSize empty slots.
+    void clearEparCache();
 
     /// Evaluation of characteristic times
     virtual void computeCharTimes();
@@ -37,6 +37,7 @@
 
 #include "microplanematerial_bazant.h"
 #include "sm/Materials/structuralms.h"
+#include "floatmatrix.h"
 
 ///@name Input fields for M4Material
 //@{
@@ -54,15 +55,28 @@
 namespace oofem {
 /**
  * Related material model status to M4Material class
- * for storing history  variables in particular integration point
- * (microplane). Unique copy for each microplane must exist.
+ * for storing history variables in particular integration point.
+ * Stresses on all microplanes are kept together (component-wise)
+ * in the status of the macro integration point.
  */
 class M4MaterialStatus : public StructuralMaterialStatus
 {
+protected:
+    /**
+     * Microplane stresses, one row per microplane, columns are the
+     * volumetric, normal, l-shear and m-shear stress.
+     */
+    FloatMatrix microplaneStress;
+    /// Temporary microplane stresses.
+    FloatMatrix tempMicroplaneStress;
+
 public:
-    M4MaterialStatus(int n, Domain *d, GaussPoint *g);
+    M4MaterialStatus(int n, Domain *d, GaussPoint *g, int nmp);
     virtual ~M4MaterialStatus();
 
+    const FloatMatrix &giveMicroplaneStress() const { return microplaneStress; }
+    FloatMatrix &giveTempMicroplaneStress() { return tempMicroplaneStress; }
+
     // definition
     virtual const char *giveClassName() const { return "M4MaterialStatus"; }
 
@@ -77,6 +91,9 @@ public:
 /**
  * Implementation of microplane material model according to Bazant's boundary curve
  * approach.
+ * All microplanes of an integration point are evaluated together, using the packed
+ * projection tensors of MicroplaneMaterial and the microplane stresses stored
+ * in M4MaterialStatus; no microplane integration points are created.
  */
 class M4Material : public MicroplaneMaterial_Bazant
 {
@@ -101,6 +118,9 @@ public:
 
     virtual void giveThermalDilatationVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
 
+    virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp,
+                                      const FloatArray &reducedStrain, TimeStep *tStep);
+
     virtual void giveRealMicroplaneStressVector(FloatArray &answer, Microplane *mplane, const FloatArray &strain, TimeStep *tStep);
 
     double macbra(double x);
@@ -119,8 +139,19 @@ public:
     virtual const char *giveInputRecordName() const { return _IFT_M4Material_Name; }
     virtual const char *giveClassName() const { return "M4Material"; }
 
+    virtual contextIOResultType saveIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
+    virtual contextIOResultType restoreIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
+
+    virtual contextIOResultType saveContext(DataStream &stream, ContextMode mode, void *obj = NULL);
+    virtual contextIOResultType restoreContext(DataStream &stream, ContextMode mode, void *obj = NULL);
+
+    virtual MaterialStatus *CreateStatus(GaussPoint *gp) const { return new M4MaterialStatus(1, domain, gp, numberOfMicroplanes); }
+
 protected:
-    MaterialStatus *CreateMicroplaneStatus(GaussPoint *gp) { return new M4MaterialStatus(1, domain, gp); }
+    MaterialStatus *CreateMicroplaneStatus(GaussPoint *gp) { return NULL; }
+    virtual void initTempStatus(GaussPoint *gp);
+    /// Sets the fixed empirical constants and the elastic moduli derived from E and nu.
+    void initializeConstants();
 };
 } // end namespace oofem
 #endif // m4_h
@@ -88,6 +88,13 @@ protected:
      * Due to symmetry, compressed form is stored.
      */
     double L [ MAX_NUMBER_OF_MICROPLANES ] [ 6 ];
+    /**
+     * Normal and shear projection tensors stored component-wise (transposed N, M and L),
+     * so that projections on all microplanes can be evaluated in a single pass.
+     */
+    double NT [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
+    double MT [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
+    double LT [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
 
     /// Young's modulus
     double E;
@@ -145,6 +152,15 @@ public:
      */
     void computeStrainVectorComponents(FloatArray &answer, Microplane *mplane,
                                        const FloatArray &macroStrain);
+    /**
+     * Computes the normal and shear (l and m direction) components of macro strain
+     * on all microplanes at once.
+     * @param en Normal components, array of size numberOfMicroplanes.
+     * @param el Shear components in l direction, array of size numberOfMicroplanes.
+     * @param em Shear components in m direction, array of size numberOfMicroplanes.
+     * @param macroStrain Macro strain vector.
+     */
+    void computePackedStrainComponents(double *en, double *el, double *em, const FloatArray &macroStrain);
 
 
     /**
@@ -183,6 +199,9 @@ public:
     virtual contextIOResultType saveIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
     virtual contextIOResultType restoreIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
 
+    virtual contextIOResultType saveContext(DataStream &stream, ContextMode mode, void *obj = NULL);
+    virtual contextIOResultType restoreContext(DataStream &stream, ContextMode mode, void *obj = NULL);
+
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
 
@@ -39,16 +39,23 @@
 #include "sm/Materials/structuralms.h"
 
 #include <memory>
+#include <vector>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_tangentReuseTol "tangent_reuse_tol"
+#define _IFT_StructuralFE2Material_romSnapshots "rom_snapshots"
+#define _IFT_StructuralFE2Material_romTol "rom_tol"
+#define _IFT_StructuralFE2Material_romCheck "rom_check"
 //@}
 
 namespace oofem {
 class EngngModel;
+class DataReader;
+class OOFEMTXTDataReader;
 class PrescribedGradientHomogenization;
 
 class StructuralFE2MaterialStatus : public StructuralMaterialStatus
@@ -62,6 +69,11 @@ protected:
     FloatMatrix tangent;
     bool oldTangent;
 
+    /// Macroscopic tangent kept for reuse.
+    FloatMatrix reusableTangent;
+    /// Macroscopic strain at which reusableTangent was computed.
+    FloatArray reusableTangentStrain;
+
     /// Interface normal direction
     FloatArray mNormalDir;
 
@@ -71,6 +83,11 @@ protected:
 
 public:
     StructuralFE2MaterialStatus(int n, Domain * d, GaussPoint * g,  const std :: string & inputfile);
+    /**
+     * Creates the status with the RVE instantiated from already parsed input.
+     * @param rveInput Parsed RVE input, copied for the instantiation.
+     */
+    StructuralFE2MaterialStatus(int n, Domain * d, GaussPoint * g, const OOFEMTXTDataReader & rveInput);
     virtual ~StructuralFE2MaterialStatus() {}
 
     EngngModel *giveRVE() { return this->rve.get(); }
@@ -81,11 +98,22 @@ public:
 
     /// Creates/Initiates the RVE problem.
     bool createRVE(int n, const std :: string &inputfile);
+    /// Creates/Initiates the RVE problem from given input.
+    bool createRVE(int n, DataReader &dr);
 
     /// Copies time step data to RVE.
     void setTimeStep(TimeStep *tStep);
 
     FloatMatrix &giveTangent() { return tangent; }
+
+    /**
+     * Gives the stored tangent if the macroscopic strain did not move further than tol
+     * (in the Euclidean norm) from the strain the tangent was computed at.
+     * @return True if answer has been set.
+     */
+    bool giveReusableTangent(FloatMatrix &answer, const FloatArray &strain, double tol) const;
+    /// Stores the tangent computed at given macroscopic strain for reuse.
+    void storeReusableTangent(const FloatMatrix &tangent, const FloatArray &strain);
     
     virtual const char *giveClassName() const { return "StructuralFE2MaterialStatus"; }
     
@@ -110,7 +138,65 @@ public:
 
 };
 
-    
+
+/**
+ * Reduced-order surrogate of the homogenized RVE response.
+ *
+ * Pairs of macroscopic strain and homogenized stress obtained from full RVE solves are collected as snapshots.
+ * A POD basis of the strain snapshots is computed by the method of snapshots (eigenvectors of the snapshot
+ * correlation matrix), and the stress snapshots are mapped onto the same modes. Online, the strain is projected
+ * onto the basis and the stress is combined from the stress modes with the same coefficients, i.e. the response is
+ * the linear map that reproduces the snapshots. This is exact for RVEs responding linearly and a projection otherwise.
+ *
+ * A strain which is not represented by the basis within the tolerance is reported, the caller then solves the full RVE
+ * and the snapshot extends the basis. Predictions can be checked periodically against full solves, the surrogate
+ * disables itself when the relative stress error exceeds the tolerance.
+ * The surrogate does not carry any history; it is meant for RVEs with a history independent response.
+ */
+class StructuralFE2Surrogate
+{
+protected:
+    /// Snapshots of macroscopic strain and stress.
+    std :: vector< FloatArray >strainSnapshots, stressSnapshots;
+    /// Orthonormal strain modes (column-wise) and the corresponding stress modes.
+    FloatMatrix strainBasis, stressBasis;
+    /// Number of full solves collected before the surrogate is used.
+    int nTraining;
+    /// Relative tolerance on the strain representation and on the stress check.
+    double tol;
+    /// Every checkInterval-th online evaluation is checked against a full solve (zero means never).
+    int checkInterval;
+    /// Number of online evaluations.
+    int nOnline;
+    /// Set when a check failed.
+    bool disabled;
+
+    /// Recomputes the modes from the snapshots.
+    void computeBasis();
+
+public:
+    StructuralFE2Surrogate() : nTraining(0), tol(1.e-6), checkInterval(0), nOnline(0), disabled(false) { }
+
+    void setParameters(int nTraining, double tol, int checkInterval);
+    /// Returns true if the surrogate is enabled (it may still be in training).
+    bool isActive() const { return nTraining > 0 && !disabled; }
+    /// Returns true if the training is finished and the surrogate can answer.
+    bool isTrained() const { return this->isActive() && (int)strainSnapshots.size() >= nTraining && strainBasis.isNotEmpty(); }
+
+    /**
+     * Evaluates the stress for the given strain.
+     * @param check Set to true if this evaluation should be verified by a full solve (see checkPrediction).
+     * @return False if the strain is not represented by the basis, the full RVE must be solved.
+     */
+    bool giveStress(FloatArray &answer, const FloatArray &strain, bool &check);
+    /// Gives the tangent of the surrogate (in the subspace spanned by the strain modes).
+    void giveTangent(FloatMatrix &answer) const;
+    /// Adds a snapshot from a full solve during training or for a strain not represented by the basis.
+    void addSnapshot(const FloatArray &strain, const FloatArray &stress);
+    /// Compares a prediction with the result of the full solve, disables the surrogate if the error is too large.
+    void checkPrediction(const FloatArray &predicted, const FloatArray &exact);
+};
+
 /**
  * Multiscale constitutive model for subscale structural problems.
  *
@@ -119,6 +205,15 @@ public:
  * - It must have a PrescribedGradient boundary condition.
  * - It must be the first boundary condition
  *
+ * The RVE input is parsed only once per material, the RVEs of individual integration points are instantiated
+ * from the parsed records. Each integration point owns an independent RVE, so the RVEs are solved
+ * concurrently when the macroscale elements are evaluated in parallel (OpenMP).
+ * Optionally (tangent_reuse_tol), the macroscopic tangent is reused as long as the macroscopic strain
+ * stays within the given distance from the strain the tangent was computed at, which saves the RVE solves
+ * needed for the (numerical) tangent.
+ * With rom_snapshots, the homogenized response is replaced by a reduced-order surrogate (StructuralFE2Surrogate)
+ * trained on the first rom_snapshots full RVE solves.
+ *
  * @author Mikael Öhman 
  */
 class StructuralFE2Material : public StructuralMaterial
@@ -127,6 +222,15 @@ protected:
     std :: string inputfile;
     static int n;
     bool useNumTangent;
+    /// Tolerance on the macroscopic strain change for reusing the tangent (zero disables the reuse).
+    double tangentReuseTol;
+    /// RVE input parsed once, shared by all integration points.
+    mutable std :: unique_ptr< OOFEMTXTDataReader >rveInput;
+    /// Reduced-order surrogate of the homogenized response, shared by all integration points.
+    StructuralFE2Surrogate surrogate;
+    /// Surrogate parameters, kept for giveInputRecord.
+    int romSnapshots, romCheck;
+    double romTol;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -139,6 +243,8 @@ public:
     virtual bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) { return true; }
 
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const;
+    /// Returns the parsed RVE input, reading the input file on the first call.
+    const OOFEMTXTDataReader &giveRVEInput() const;
     // stress computation methods
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     
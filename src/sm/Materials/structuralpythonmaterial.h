@@ -41,6 +41,8 @@ namespace bp=boost::python;
 #include "sm/Materials/structuralmaterial.h"
 #include "sm/Materials/structuralms.h"
 
+#include <vector>
+
 #if 0
 #ifndef PyObject_HEAD
 struct _object;
@@ -52,6 +54,7 @@ typedef _object PyObject;
 //@{
 #define _IFT_StructuralPythonMaterial_Name "structuralpythonmaterial"
 #define _IFT_StructuralPythonMaterial_moduleName "module" /// The name of the module with the supplied functions (i.e. the name of the python script, without file extension)
+#define _IFT_StructuralPythonMaterial_stateSize "statesize" ///< Number of state variables per integration point in batch mode
 //@}
 
 namespace oofem {
@@ -68,7 +71,18 @@ namespace oofem {
  * computePK1StressTangent(F, P, state, time) # return dP/dF
  * @endcode
  * else numerical derivatives are used. The state variable should be a dictionary storing either doubles or arrays of doubles.
- * 
+ *
+ * Alternatively, the module can provide a batched function for small deformations
+ * @code{.py}
+ * computeStressBatch(oldStrain, oldStress, strain, oldState, stress, state, tangent, time) # fills stress, state and tangent
+ * @endcode
+ * which is called once for all integration points (in 3D material mode) of the elements using this material.
+ * The arguments are memoryviews of contiguous arrays of shape (n,6), (n,6), (n,6), (n,statesize), (n,6), (n,statesize) and (n,6,6),
+ * which share memory with the material (no copies are made); numpy.asarray gives writable array views of them.
+ * The state is then a fixed size array per point instead of a dictionary. The interpreter lock is taken once per batch.
+ * The batch is computed when the first point of the previous batch requests new stresses; results are used
+ * for points whose strain matches the one used in the batch, other points are evaluated individually.
+ *
  * This code is still experimental, and needs extensive testing.
  * @author Mikael Öhman
  */
@@ -83,6 +97,12 @@ private:
     bp::object smallDef, smallDefTangent;
     // callables for large deformations
     bp::object largeDef, largeDefTangent;
+    /// callable for batched small deformations
+    bp::object smallDefBatch;
+    /// Number of state variables per integration point in batch mode
+    int stateSize;
+    /// Integration points evaluated in the last batch
+    std :: vector< GaussPoint * >batchPoints;
 #if 0
     /// Compiled function for small deformations
     PyObject *smallDef;
@@ -108,6 +128,15 @@ public:
 
     void callStressFunction(bp::object func, const FloatArray &oldStrain, const FloatArray &oldStress, const FloatArray &strain, FloatArray &stress, bp::object stateDict, bp::object tempStateDict, TimeStep *tStep) const;
     void callTangentFunction(FloatMatrix &answer, bp::object func, const FloatArray &strain, const FloatArray &stress, bp::object stateDict, bp::object tempStateDict, TimeStep *tStep) const;
+    /**
+     * Calls the batched stress function for given points and stores stress, state and tangent in their statuses.
+     * @param gps Integration points.
+     * @param strains Full 3D strain for each point.
+     * @param tStep Time step.
+     */
+    void callStressBatchFunction(const std :: vector< GaussPoint * > &gps, const std :: vector< FloatArray > &strains, TimeStep *tStep);
+    /// Collects all 3D integration points using this material, computes their strains and evaluates them in one batch.
+    void computeBatch(TimeStep *tStep);
 
     virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer,
                                                MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
@@ -135,6 +164,13 @@ class StructuralPythonMaterialStatus : public StructuralMaterialStatus
 protected:
     /// Internal state variables
     bp::dict stateDict, tempStateDict;
+    /// Internal state variables in batch mode
+    FloatArray stateVector, tempStateVector;
+    /// Tangent computed together with the stress in batch mode
+    FloatMatrix tempTangent;
+    /// Strain and time for which the temporary batch results were computed (empty if invalid)
+    FloatArray batchStrain;
+    double batchTime;
 #if 0
     PyObject *stateDict;
     PyObject *tempStateDict;
@@ -153,6 +189,16 @@ public:
     bp::object giveStateDictionary() { return stateDict; }
     bp::object giveTempStateDictionary() { return tempStateDict; }
 
+    const FloatArray &giveStateVector() const { return stateVector; }
+    const FloatArray &giveTempStateVector() const { return tempStateVector; }
+    void letTempStateVectorBe(const FloatArray &v) { tempStateVector = v; }
+    const FloatMatrix &giveTempTangent() const { return tempTangent; }
+    void letTempTangentBe(const FloatMatrix &t) { tempTangent = t; }
+    /// Marks the temporary values as computed for given strain and time.
+    void setBatchStrain(const FloatArray &strain, double time) { batchStrain = strain; batchTime = time; }
+    /// Checks if the temporary values were computed by a batch for given strain and time.
+    bool isBatchValid(const FloatArray &strain, double time) const;
+
     virtual const char *giveClassName() const { return "StructuralPythonMaterialStatus"; }
 };
 } // end namespace oofem
@@ -135,6 +135,9 @@ protected:
     /// Determines if there are change in the problem size (no application/removal of Dirichlet boundary conditions).
     bool changingProblemSize;
 
+    /// Time increment used to assemble the current lhs matrix. The matrix (and its factorization) is kept as long as the increment is the same.
+    double lhsTimeIncrement;
+
 public:
     /// Constructor.
     NonStationaryTransportProblem(int i, EngngModel * _master);
@@ -52,6 +52,11 @@
 #define _IFT_TransientTransportProblem_keepTangent "keeptangent" ///< Fixes the tangent to be reused on each step.
 #define _IFT_TransientTransportProblem_lumped "lumped" ///< Use of lumped "mass" matrix
 #define _IFT_TransientTransportProblem_exportFields "exportfields" ///< Fields to export for staggered problems.
+#define _IFT_TransientTransportProblem_errorTolerance "errortol" ///< Relative local error tolerance; enables adaptive time stepping.
+#define _IFT_TransientTransportProblem_dtMin "dtmin" ///< Minimum time step in adaptive time stepping.
+#define _IFT_TransientTransportProblem_dtMax "dtmax" ///< Maximum time step in adaptive time stepping.
+#define _IFT_TransientTransportProblem_dtGrowth "dtgrowth" ///< Maximum ratio between consecutive time steps in adaptive time stepping.
+#define _IFT_TransientTransportProblem_endTime "endtime" ///< Time at which the adaptive analysis ends (optional).
 //@}
 
 namespace oofem {
@@ -60,6 +65,15 @@ class Function;
 
 /**
  * Solves general nonlinear transient transport problems.
+ *
+ * If an error tolerance is given, the time step is adapted. The local error of each step is estimated by comparing
+ * the solution with an explicit predictor extrapolated from the rates @f$ r_n = (u_n - u_{n-1})/\Delta t_n @f$ of previous steps;
+ * linearly (@f$ u^P = u_n + \Delta t\, r_n @f$, first order error) for @f$ \alpha \neq 0.5 @f$, and from the last two rates
+ * (second order error) for the trapezoidal rule. The estimate is scaled by the ratio of the error constants of the schemes
+ * and taken relative to @f$ \| u_{n+1} \| @f$.
+ * Steps with error above the tolerance (or failing to converge) are rejected; the material statuses are reset
+ * and the step is repeated with a shorter time increment. The size of the next step is predicted from the error of the accepted step.
+ * The initial step size is given by deltat, and the analysis ends at endtime (if given) or after nsteps steps.
  * @author Mikael Öhman
  */
 class TransientTransportProblem : public EngngModel
@@ -82,10 +96,37 @@ protected:
     FloatArray prescribedTimes;
     double deltaT;
     bool keepTangent, hasTangent;
+    /// Time increment used in the current effective tangent.
+    double tangentDeltaT;
     bool lumped;
 
     IntArray exportFields;
 
+    ///@name Adaptive time stepping
+    //@{
+    /// Relative local error tolerance (zero if time step is not adaptive).
+    double errorTolerance;
+    double dtMin, dtMax, dtGrowth;
+    double endTime;
+    /// Time increment proposed for the next step.
+    double adaptiveDeltaT;
+    /// Rates of the solution in the last two accepted steps.
+    FloatArray previousRate, previousRate2;
+    /// Time increments of the last two accepted steps.
+    double previousDeltaT, previousDeltaT2;
+    //@}
+
+    /**
+     * Estimates the relative local error of the solution in given step.
+     * @param order Order of the error estimate (exponent of the time increment is order+1).
+     * @return Error estimate, or a negative value if there is no previous rate to compare with.
+     */
+    double estimateLocalError(TimeStep *tStep, int &order);
+    /// Changes the time increment of the given step (which has not been accepted yet).
+    void resetTimeIncrement(TimeStep *tStep, double dt);
+    /// Assembles and solves the equations of the given step.
+    NM_Status solveTimeStep(TimeStep *tStep);
+
 public:
     /// Constructor.
     TransientTransportProblem(int i, EngngModel * _master);
@@ -42,6 +42,7 @@
 #include <cstdio>
 #include <string>
 #include <cstring>
+#include <memory>
 
 #include <tinyxml2.h>
 
@@ -61,6 +62,7 @@ using namespace tinyxml2;
 #define _IFT_CemhydMat_capacitytype "capacitytype"
 #define _IFT_CemhydMat_densitytype "densitytype"
 #define _IFT_CemhydMat_eachgp "eachgp"
+#define _IFT_CemhydMat_sharemicrostructure "sharemicrostructure"
 #define _IFT_CemhydMat_nowarnings "nowarnings"
 #define _IFT_CemhydMat_scaling "scaling"
 #define _IFT_CemhydMat_reinforcementDegree "reinforcementdegree"
@@ -138,6 +140,11 @@ public:
     int reinforcementDegree;
     /// Assign a separate microstructure in each integration point.
     int eachGP;
+    /**
+     * With eachGP, generate (or read) the initial microstructure only once and let all integration points
+     * hydrate their own copy of it. The original phase and particle-ID arrays are shared, not duplicated.
+     */
+    int shareMicrostructure;
     /// XML input file name for CEMHYD3D.
     std :: string XMLfileName;
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const;
@@ -146,6 +153,8 @@ public:
      * When Cemhyd3D runs seperately in each GP, MasterCemhydMatStatus belongs to the first instance, from which the microstructure is copied to the rest of integration points.
      */
     CemhydMatStatus *MasterCemhydMatStatus;
+    /// Status which generated the initial microstructure shared by all integration points (eachGP with shareMicrostructure).
+    CemhydMatStatus *SourceCemhydMatStatus;
 };
 #endif
 
@@ -497,8 +506,25 @@ private:
     void alloc_double_3D(double ***( &mic ), long SYSIZE);
     void dealloc_double_3D(double ***( &mic ), long SYSIZE);
 
-    char ***micorig; //char micorig [SYSIZE] [SYSIZE] [SYSIZE];
-    long int ***micpart; //long int micpart [SYSIZE] [SYSIZE] [SYSIZE];
+    /**
+     * Original phases and particle IDs of the 3D microstructure. Both arrays are written only when the
+     * microstructure is generated or read and remain constant during hydration, so statuses copied
+     * from another status (eachGP) share them instead of holding their own SYSIZE^3 copies.
+     */
+    struct InitialMicrostructure {
+        char ***micorig;
+        long int ***micpart;
+        long size;
+        InitialMicrostructure(long size);
+        ~InitialMicrostructure();
+    };
+    /// Original microstructure, possibly shared with other statuses.
+    std :: shared_ptr< InitialMicrostructure >initialMicrostructure;
+    /// Flag whether the original microstructure is owned by another status and must not be rewritten.
+    bool sharedMicrostructure;
+
+    char ***micorig; //char micorig [SYSIZE] [SYSIZE] [SYSIZE], points to initialMicrostructure
+    long int ***micpart; //long int micpart [SYSIZE] [SYSIZE] [SYSIZE], points to initialMicrostructure
 
     //genpartnew
     /* data structure for clusters to be used in flocculation */